@@ -0,0 +1,10 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with the checkpoints
+# written in the background
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Checkpoints.async_dump = True
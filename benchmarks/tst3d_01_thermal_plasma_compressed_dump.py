@@ -0,0 +1,13 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with compressed
+# checkpoints (Zstandard, or deflate without its plugin) and fields (deflate)
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Checkpoints.dump_compression = "zstd"
+Checkpoints.dump_deflate = 1
+
+DiagFields[0].compression = "deflate"
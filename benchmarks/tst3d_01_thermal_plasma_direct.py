@@ -0,0 +1,10 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with the particles sent
+# directly to all the neighbor patches, corners included (small patches of 8^3 cells)
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Main.direct_particle_exchange = True
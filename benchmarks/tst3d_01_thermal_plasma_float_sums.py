@@ -0,0 +1,14 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with the densities summed
+# in single precision between MPI processes (small patches of 8^3 cells)
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Main.float_sums = True
+
+DiagPerformances(
+    every = 40,
+)
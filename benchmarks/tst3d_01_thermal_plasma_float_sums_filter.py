@@ -0,0 +1,21 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with the densities summed
+# in single precision between MPI processes (small patches of 8^3 cells), and a
+# binomial current filter which exchanges the currents between MPI processes.
+# To be run with several MPI processes.
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Main.float_sums = True
+
+CurrentFilter(
+    model = "binomial",
+    passes = [2,2,2],
+)
+
+DiagPerformances(
+    every = 40,
+)
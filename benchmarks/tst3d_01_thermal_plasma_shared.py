@@ -0,0 +1,12 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+#
+# Same as tst3d_01_thermal_plasma (without the screens), with the fields exchanged
+# in one message per neighbor MPI process, read in shared memory within a node
+# (small patches of 8^3 cells)
+#
+# extends thermal_plasma_small_patches.py
+# ----------------------------------------------------------------------------------------
+
+Main.aggregate_communications = True
+Main.shared_memory_communications = True
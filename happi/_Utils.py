@@ -90,6 +90,7 @@ class ChunkedRange:
 def openNamelist(namelist):
 	"""
 	Function to execute a namelist and store all its content in the returned object.
+	The namelist may also be a list of files, executed in order, as Smilei does.
 
 	Example:
 		namelist = happi.openNamelist("path/no/my/namelist.py")
@@ -108,7 +109,8 @@ def openNamelist(namelist):
 	namespace={}
 	exec(open(smilei_python_directory+sep+"pyinit.py").read(), namespace)
 	exec(open(smilei_python_directory+sep+"pyprofiles.py").read(), namespace)
-	exec(open(namelist).read(), namespace) # execute the namelist
+	for file in (namelist if type(namelist) in [list, tuple] else [namelist]):
+		exec(open(file).read(), namespace) # execute the namelist
 	exec(open(smilei_python_directory+sep+"pycontrol.py").read(), namespace)
 	class Namelist: pass # empty class to store the namelist variables
 	namelist = Namelist() # create new empty object
@@ -7,8 +7,12 @@
 #include "Checkpoint.h"
 
 #include <sstream>
+#include <fstream>
 #include <iomanip>
 #include <string>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
 
 #include <mpi.h>
 
@@ -48,11 +52,17 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
     dump_step( 0 ),
     dump_minutes( 0.0 ),
     exit_after_dump( true ),
+    async_dump( false ),
+    incremental_dump( false ),
     time_reference( MPI_Wtime() ),
     keep_n_dumps( 2 ),
     keep_n_dumps_max( 10000 ),
     dump_deflate( 0 ),
-    file_grouping( 0 )
+    file_grouping( 0 ),
+    dump_image_index_( 0 ),
+    dump_writer_failed_( false ),
+    base_id_( -1 ),
+    replaced_base_( -1 )
 {
 
     if( PyTools::nComponents( "Checkpoints" ) > 0 ) {
@@ -81,6 +91,33 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
 
         PyTools::extract( "dump_deflate", dump_deflate, "Checkpoints"  );
 
+        PyTools::extractOrNone( "dump_compression", dump_compression_, "Checkpoints" );
+        if( dump_compression_.empty() && dump_deflate > 0 ) {
+            dump_compression_ = "deflate";
+        }
+        if( ! dump_compression_.empty() ) {
+            if( dump_compression_ != "zstd" && dump_compression_ != "lz4" && dump_compression_ != "deflate" ) {
+                ERROR_NAMELIST( "Checkpoints: dump_compression must be `zstd`, `lz4` or `deflate`", LINK_NAMELIST + std::string("#checkpoints") );
+            }
+            MESSAGE( 1, "Checkpoint files will be compressed with " << dump_compression_ << " (level " << dump_deflate << ")" );
+        }
+
+        PyTools::extract( "async_dump", async_dump, "Checkpoints"  );
+        if( async_dump ) {
+            MESSAGE( 1, "Checkpoint files will be written in the background" );
+        }
+
+        PyTools::extract( "incremental_dump", incremental_dump, "Checkpoints"  );
+        if( incremental_dump ) {
+            MESSAGE( 1, "Frozen species will be linked to base files instead of being written in each checkpoint" );
+        }
+
+        PyTools::extractOrNone( "local_dump_dir", local_dump_dir_, "Checkpoints" );
+        if( ! local_dump_dir_.empty() ) {
+            MESSAGE( 1, "Checkpoint files will be written in " << local_dump_dir_ << ", then copied in the background" );
+            local_dump_dir_ += PATH_SEPARATOR;
+        }
+
         PyTools::extract( "file_grouping", file_grouping, "Checkpoints"  );
         if( file_grouping > 0 ) {
             if( file_grouping > ( unsigned int )( smpi->getSize() ) ) {
@@ -97,7 +134,10 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
                 ERROR( "Internal parameter `restart_files` not understood. This should not happen" );
             }
 
+            PyTools::extractOrNone( "restart_dir", restart_dir_, "Checkpoints" );
+
             // This will open all dumps and pick the last one
+            // (node-local copies come first, so that they are preferred to identical dumps of restart_dir)
             restart_file = "";
             for( unsigned int num_dump=0; num_dump<restart_files.size(); num_dump++ ) {
                 string dump_name = restart_files[num_dump];
@@ -118,6 +158,19 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
                 ERROR( "Cannot find a valid restart file for rank "<<smpi->getRank() );
             }
 
+            // The files of the rank 0 are only valid for the processes absent from the dumped simulation
+            const size_t rank_start = restart_file.rfind( '-' ) + 1;
+            if( atoi( restart_file.substr( rank_start ).c_str() ) != smpi->getRank() ) {
+                H5Read f( restart_file );
+                vector<int> patch_count;
+                f.vect( "patch_count", patch_count, true );
+                if( smpi->getRank() < ( int )patch_count.size() ) {
+                    ERROR( "Cannot find valid restart files for processor " << smpi->getRank()
+                           << " (the dump was written by " << patch_count.size() << " processes)"
+                           << "\n\t\trestart_dir = '" << restart_dir_ << "'" );
+                }
+            }
+
             // Make sure all ranks have the same dump number
             // Different numbers can be due to corrupted restart files
             if( ! smpi->test_mode ) {
@@ -177,10 +230,20 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
         WARNING( "Cannot catch signal SIGUSR2" );
     }
 
+    dump_base_.resize( keep_n_dumps, -1 );
+    if( params.restart && incremental_dump ) {
+        restartBaseFiles( smpi );
+    }
+
     nDim_particle=params.nDim_particle;
 }
 
-Checkpoint::~Checkpoint() {}
+Checkpoint::~Checkpoint()
+{
+    if( dump_writer_.joinable() ) {
+        dump_writer_.join();
+    }
+}
 
 void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int itime, SmileiMPI *smpi, SimWindow *simWindow, Params &params )
 {
@@ -209,26 +272,135 @@ void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int iti
     }
 }
 
+// Files are written under a temporary name, then renamed, so that an interrupted write does not leave a truncated dump
+static bool writeFile( const string &name, const vector<char> &data )
+{
+    string tmpName = name + ".tmp";
+    ofstream file( tmpName.c_str(), ios::binary | ios::trunc );
+    file.write( data.data(), data.size() );
+    file.close();
+    return ! file.fail() && rename( tmpName.c_str(), name.c_str() ) == 0;
+}
+
+static bool copyFile( const string &source, const string &name )
+{
+    ifstream in( source.c_str(), ios::binary );
+    if( ! in.is_open() ) {
+        return false;
+    }
+    string tmpName = name + ".tmp";
+    ofstream file( tmpName.c_str(), ios::binary | ios::trunc );
+    file << in.rdbuf();
+    file.close();
+    return ! file.fail() && rename( tmpName.c_str(), name.c_str() ) == 0;
+}
+
+string Checkpoint::dumpDirectory( SmileiMPI *smpi )
+{
+    ostringstream dir( "" );
+    dir << "checkpoints" << PATH_SEPARATOR;
+    if( file_grouping>0 ) {
+        dir << setfill( '0' ) << setw( int( 1+log10( smpi->getSize()/file_grouping+1 ) ) ) << smpi->getRank()/file_grouping << PATH_SEPARATOR;
+    }
+    return dir.str();
+}
+
 void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin,  Params &params )
 {
     unsigned int num_dump=dump_number % keep_n_dumps;
 
+    dump_dir = dumpDirectory( smpi );
     ostringstream nameDumpTmp( "" );
-    nameDumpTmp << "checkpoints" << PATH_SEPARATOR;
-    if( file_grouping>0 ) {
-        nameDumpTmp << setfill( '0' ) << setw( int( 1+log10( smpi->getSize()/file_grouping+1 ) ) ) << smpi->getRank()/file_grouping << PATH_SEPARATOR;
+    nameDumpTmp << dump_dir << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
+    std::string dumpName=nameDumpTmp.str();
+
+    // With a node-local directory, the file is written there first (with the same tree and rotation),
+    // then copied to the checkpoints directory by a thread while the simulation goes on
+    std::string writeName = local_dump_dir_ + dumpName;
+    int previous_base = base_id_;
+
+    // Sizes of the data (uncompressed and stored) and time to write the file, for compressed dumps
+    double sizes[2] = { 0., 0. };
+    double write_time = MPI_Wtime();
+
+    std::vector<char> *image = NULL;
+    if( async_dump ) {
+        // The file is built in memory, then written by a thread while the simulation goes on.
+        // The image of the previous dump may still be in use by the thread: the other one is filled.
+        image = &dump_image_[dump_image_index_];
+        {
+            H5Write f( writeName, image );
+            dumpFile( f, sizes, vecPatches, region, itime, smpi, simWin, params );
+        }
+        write_time = MPI_Wtime() - write_time;
+        waitDump();
+        dump_image_index_ = 1 - dump_image_index_;
+    } else {
+        // The thread may still be copying the local file about to be overwritten
+        if( ! local_dump_dir_.empty() ) {
+            waitDump();
+        }
+        write_time = MPI_Wtime();
+        {
+            H5Write f( writeName );
+            dumpFile( f, sizes, vecPatches, region, itime, smpi, simWin, params );
+        }
+        write_time = MPI_Wtime() - write_time;
     }
 
-    nameDumpTmp << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
-    std::string dumpName=nameDumpTmp.str();
+    if( ! dump_compression_.empty() ) {
+        MPI_Allreduce( MPI_IN_PLACE, sizes, 2, MPI_DOUBLE, MPI_SUM, smpi->world() );
+        MPI_Allreduce( MPI_IN_PLACE, &write_time, 1, MPI_DOUBLE, MPI_MAX, smpi->world() );
+        MESSAGE( 2, "Compression ratio " << sizes[0] / std::max( sizes[1], 1. )
+                 << ", " << sizes[0] / std::max( write_time, 1e-9 ) / 1048576. << " MB/s of uncompressed data"
+                 << ( async_dump ? " (in memory)" : "" ) );
+    }
+    if( incremental_dump ) {
+        cleanBaseFiles();
+    }
 
+    if( image || ! local_dump_dir_.empty() ) {
+        // A new base file is copied before the dump linking to it
+        dump_writer_drain_.clear();
+        if( ! local_dump_dir_.empty() ) {
+            if( incremental_dump && base_id_ != previous_base ) {
+                dump_writer_drain_.push_back( dump_dir + base_name_ );
+            }
+            dump_writer_drain_.push_back( dumpName );
+        }
+        dump_writer_file_ = writeName;
+        dump_writer_ = std::thread( [this, image]() {
+            dump_writer_failed_ = false;
+            if( image ) {
+                dump_writer_failed_ = ! writeFile( dump_writer_file_, *image );
+                std::vector<char>().swap( *image );
+            }
+            for( unsigned int i=0; i<dump_writer_drain_.size() && ! dump_writer_failed_; i++ ) {
+                dump_writer_file_ = dump_writer_drain_[i];
+                dump_writer_failed_ = ! copyFile( local_dump_dir_ + dump_writer_file_, dump_writer_file_ );
+            }
+        } );
+    }
+}
 
-    H5Write f( dumpName );
+void Checkpoint::waitDump()
+{
+    if( dump_writer_.joinable() ) {
+        dump_writer_.join();
+        if( dump_writer_failed_ ) {
+            ERROR( "Cannot write checkpoint file " << dump_writer_file_ );
+        }
+    }
+}
+
+void Checkpoint::dumpFile( H5Write &f, double sizes[2], VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin,  Params &params )
+{
+    unsigned int num_dump=dump_number % keep_n_dumps;
     dump_number++;
 
 #ifdef  __DEBUG
     //MESSAGEALL( "Step " << itime << " : DUMP fields and particles " << dumpName );
-    MESSAGEALL( " Checkpoint #" << dumpName << " at iteration " << itime << " dumped" );
+    MESSAGEALL( " Checkpoint #" << num_dump << " at iteration " << itime << " dumped" );
 #else
     MESSAGE( " Checkpoint #" << num_dump << " at iteration " << itime << " dumped" );
 #endif
@@ -245,6 +417,16 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
     //vecPatches.copyDeviceStateToHost();
 #endif
 
+    if( incremental_dump ) {
+        prepareBase( local_dump_dir_ + dump_dir, vecPatches, smpi, itime * params.timestep );
+        replaced_base_ = dump_base_[num_dump];
+        dump_base_[num_dump] = frozen_particles_.empty() ? -1 : base_id_;
+    }
+
+    if( ! dump_compression_.empty() ) {
+        f.compression( dump_compression_, dump_deflate );
+    }
+
     // Write basic attributes
     f.attr( "Version", string( __VERSION ) );
 
@@ -252,6 +434,23 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
     f.attr( "dump_number", dump_number );
 
     f.vect( "patch_count", smpi->patch_count );
+    f.attr( "file_grouping", file_grouping );
+
+    // Load of each patch (as in the dynamic load balancing), to distribute the patches
+    // when restarting with a different number of MPI processes
+    unsigned int ncells_perpatch = 1;
+    for( unsigned int idim = 0; idim < params.nDim_field; idim++ ) {
+        ncells_perpatch *= params.patch_size_[idim]+2*params.oversize[idim];
+    }
+    vector<double> patch_load( vecPatches.size(), ncells_perpatch*params.cell_load );
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
+        for( unsigned int ispec=0 ; ispec<vecPatches( ipatch )->vecSpecies.size() ; ispec++ ) {
+            Species *spec = vecPatches( ipatch )->vecSpecies[ispec];
+            bool frozen = itime * params.timestep < spec->time_frozen_;
+            patch_load[ipatch] += spec->getNbrOfParticles() * ( frozen ? params.frozen_particle_load : 1. );
+        }
+    }
+    f.vect( "patch_load", patch_load );
 
     // Write diags scalar data
     DiagnosticScalar *scalars = static_cast<DiagnosticScalar *>( vecPatches.globalDiags[0] );
@@ -299,7 +498,7 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
         string patchName=Tools::merge( "patch-", patch_name.str() );
         H5Write g = f.group( patchName.c_str() );
 
-        dumpPatch( vecPatches( ipatch ), params, g );
+        dumpPatch( vecPatches( ipatch ), params, g, incremental_dump );
 
         // Random number generator state
         g.attr( "xorshift32_state", vecPatches( ipatch )->rand_->xorshift32_state );
@@ -329,10 +528,16 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
         dumpMovingWindow( f, simWin );
     }
 
+    if( ! dump_compression_.empty() ) {
+        hsize_t raw, stored;
+        f.storageSize( raw, stored );
+        sizes[0] = raw;
+        sizes[1] = stored;
+    }
 }
 
 
-void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
+void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g, bool link_frozen )
 {
     ElectroMagn * EMfields = patch->EMfields;
     if (  params.geometry != "AMcylindrical" ) {
@@ -528,7 +733,8 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
         s.attr( "nrj_new_part", spec->nrj_new_part_ );
         s.attr( "radiatedEnergy", spec->nrj_radiated_ );
 
-        if( spec->getNbrOfParticles()>0 ) {
+        if( spec->getNbrOfParticles()>0
+            && !( link_frozen && linkFrozenParticles( s, patch->Hindex(), ispec ) ) ) {
             dumpParticles( s, *spec->particles );
             s.vect( "first_index", spec->particles->first_index );
             s.vect( "last_index", spec->particles->last_index );
@@ -584,6 +790,180 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
 };
 
 
+// Hash of a buffer, 8 bytes at a time
+static void hashBuffer( uint64_t &hash, const void *data, size_t size )
+{
+    const char *c = static_cast<const char *>( data );
+    for( size_t i=0; i+8<=size; i+=8 ) {
+        uint64_t w;
+        memcpy( &w, c+i, 8 );
+        hash = ( hash ^ w ) * 0x100000001b3ULL;
+        hash ^= hash >> 32;
+    }
+    for( size_t i=size-size%8; i<size; i++ ) {
+        hash = ( hash ^ ( unsigned char )c[i] ) * 0x100000001b3ULL;
+    }
+    hash = ( hash ^ size ) * 0x100000001b3ULL;
+}
+
+template<class T>
+static void hashVector( uint64_t &hash, const std::vector<T> &v )
+{
+    hashBuffer( hash, v.data(), v.size()*sizeof( T ) );
+}
+
+// Hash of the particle data written by Checkpoint::dumpParticles, with the bin indices
+static uint64_t hashParticles( Particles &p )
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for( unsigned int i=0; i<p.Position.size(); i++ ) {
+        hashVector( hash, p.Position[i] );
+    }
+    for( unsigned int i=0; i<p.Momentum.size(); i++ ) {
+        hashVector( hash, p.Momentum[i] );
+    }
+    hashVector( hash, p.Weight );
+    hashVector( hash, p.Charge );
+    if( p.tracked ) {
+        hashVector( hash, p.Id );
+    }
+    if( p.has_Monte_Carlo_process ) {
+        hashVector( hash, p.Tau );
+    }
+    if( p.interpolated_fields_ ) {
+        for( unsigned int i=6; i<9; i++ ) {
+            if( p.interpolated_fields_->mode_[i] == 2 ) {
+                hashVector( hash, p.interpolated_fields_->F_[i] );
+            }
+        }
+    }
+    hashVector( hash, p.first_index );
+    hashVector( hash, p.last_index );
+    return hash;
+}
+
+void Checkpoint::prepareBase( string dir, VectorPatch &vecPatches, SmileiMPI *smpi, double time )
+{
+    // Hash the particles of the frozen species, and count those unchanged since the current base file
+    frozen_particles_.clear();
+    uint64_t n_frozen = 0, n_unchanged = 0;
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
+        Patch *patch = vecPatches( ipatch );
+        ostringstream patch_name( "" );
+        patch_name << "/patch-" << setfill( '0' ) << setw( 6 ) << patch->Hindex();
+        for( unsigned int ispec=0 ; ispec<patch->vecSpecies.size() ; ispec++ ) {
+            Species *spec = patch->vecSpecies[ispec];
+            if( spec->time_frozen_ <= time || spec->getNbrOfParticles() == 0 ) {
+                continue;
+            }
+            std::pair<unsigned int, unsigned int> key( patch->Hindex(), ispec );
+            FrozenParticles &frozen = frozen_particles_[key];
+            frozen.hash = hashParticles( *spec->particles );
+            ostringstream name( "" );
+            name << setfill( '0' ) << setw( 2 ) << ispec;
+            frozen.group = patch_name.str() + Tools::merge( "/species-", name.str(), "-", spec->name_ );
+            n_frozen += spec->getNbrOfParticles();
+            std::map<std::pair<unsigned int, unsigned int>, FrozenParticles>::iterator base = base_particles_.find( key );
+            if( base != base_particles_.end() && base->second.hash == frozen.hash ) {
+                n_unchanged += spec->getNbrOfParticles();
+            }
+        }
+    }
+
+    // A new base file is written when less than half of the frozen particles are found in the current one
+    if( frozen_particles_.empty() || 2*n_unchanged >= n_frozen ) {
+        return;
+    }
+    base_id_ = dump_number;
+    ostringstream base_name( "" );
+    base_name << "base-" << setfill( '0' ) << setw( 5 ) << base_id_ << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
+    base_name_ = base_name.str();
+    base_files_[base_id_] = dir + base_name_;
+    base_particles_.clear();
+
+    H5Write b( dir + base_name_ );
+    if( ! dump_compression_.empty() ) {
+        b.compression( dump_compression_, dump_deflate );
+    }
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
+        Patch *patch = vecPatches( ipatch );
+        for( unsigned int ispec=0 ; ispec<patch->vecSpecies.size() ; ispec++ ) {
+            std::pair<unsigned int, unsigned int> key( patch->Hindex(), ispec );
+            std::map<std::pair<unsigned int, unsigned int>, FrozenParticles>::iterator frozen = frozen_particles_.find( key );
+            if( frozen == frozen_particles_.end() ) {
+                continue;
+            }
+            // Groups of the base file are named as in the checkpoint files
+            size_t slash = frozen->second.group.rfind( '/' );
+            H5Write p = b.group( frozen->second.group.substr( 1, slash-1 ) );
+            H5Write s = p.group( frozen->second.group.substr( slash+1 ) );
+            Particles &particles = *patch->vecSpecies[ispec]->particles;
+            dumpParticles( s, particles );
+            s.vect( "first_index", particles.first_index );
+            s.vect( "last_index", particles.last_index );
+            FrozenParticles &base = base_particles_[key];
+            base = frozen->second;
+            base.datasets = s.links();
+        }
+    }
+}
+
+bool Checkpoint::linkFrozenParticles( H5Write &s, unsigned int hindex, unsigned int ispec )
+{
+    std::pair<unsigned int, unsigned int> key( hindex, ispec );
+    std::map<std::pair<unsigned int, unsigned int>, FrozenParticles>::iterator frozen = frozen_particles_.find( key );
+    std::map<std::pair<unsigned int, unsigned int>, FrozenParticles>::iterator base = base_particles_.find( key );
+    if( frozen == frozen_particles_.end() || base == base_particles_.end() || frozen->second.hash != base->second.hash ) {
+        return false;
+    }
+    for( unsigned int i=0; i<base->second.datasets.size(); i++ ) {
+        s.externalLink( base->second.datasets[i], base_name_, base->second.group + "/" + base->second.datasets[i] );
+    }
+    return true;
+}
+
+void Checkpoint::restartBaseFiles( SmileiMPI *smpi )
+{
+    // The dumps of the previous runs kept in the checkpoints directory link to base files which are
+    // found from their external links, so that they are removed once no kept dump uses them
+    dump_dir = dumpDirectory( smpi );
+    for( unsigned int num_dump=0; num_dump<keep_n_dumps; num_dump++ ) {
+        ostringstream name( "" );
+        name << dump_dir << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
+        H5Read f( name.str(), NULL, false );
+        if( ! f.valid() ) {
+            continue;
+        }
+        vector<string> files = f.externalFiles();
+        for( unsigned int i=0; i<files.size(); i++ ) {
+            if( files[i].compare( 0, 5, "base-" ) == 0 ) {
+                int base_id = atoi( files[i].substr( 5 ).c_str() );
+                dump_base_[num_dump] = base_id;
+                base_files_[base_id] = local_dump_dir_ + dump_dir + files[i];
+            }
+        }
+    }
+}
+
+void Checkpoint::cleanBaseFiles()
+{
+    // The base of the dump replaced by the file being written (or copied) in the background is still needed
+    std::map<int, std::string>::iterator it = base_files_.begin();
+    while( it != base_files_.end() ) {
+        if( it->first == base_id_
+            || ( ( async_dump || ! local_dump_dir_.empty() ) && it->first == replaced_base_ )
+            || std::find( dump_base_.begin(), dump_base_.end(), it->first ) != dump_base_.end() ) {
+            it++;
+        } else {
+            std::remove( it->second.c_str() );
+            if( ! local_dump_dir_.empty() ) {
+                std::remove( it->second.substr( local_dump_dir_.size() ).c_str() );
+            }
+            it = base_files_.erase( it );
+        }
+    }
+}
+
 void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
 {
     H5Read f( restart_file );
@@ -597,14 +977,72 @@ void Checkpoint::readPatchDistribution( SmileiMPI *smpi, SimWindow *simWin )
         WARNING( "                while running version is " << string( __VERSION ) );
     }
 
-    vector<int> patch_count( smpi->getSize() );
-    f.vect( "patch_count", patch_count );
-    smpi->patch_count = patch_count;
+    vector<int> patch_count;
+    f.vect( "patch_count", patch_count, true );
+
+    if( patch_count.size() == ( unsigned int )smpi->getSize() ) {
+        smpi->patch_count = patch_count;
+
+        smpi->patch_refHindexes.resize( smpi->patch_count.size(), 0 );
+        smpi->patch_refHindexes[0] = 0;
+        for( int rk=1 ; rk<smpi->smilei_sz ; rk++ ) {
+            smpi->patch_refHindexes[rk] = smpi->patch_refHindexes[rk-1] + smpi->patch_count[rk-1];
+        }
+    } else {
+        // The dump comes from another number of MPI processes: the patches are distributed again,
+        // and each process reads its patches from the files of the processes which dumped them.
+        // These files are found next to the restart file.
+        restart_patch_count_ = patch_count;
+        unsigned int old_size = patch_count.size();
+        unsigned int old_file_grouping = 0;
+        string checkpoints = string( "checkpoints" ) + PATH_SEPARATOR;
+        size_t checkpoints_dir = restart_file.rfind( checkpoints );
+        if( checkpoints_dir == string::npos ) {
+            ERROR( "Cannot find the checkpoints directory of " << restart_file );
+        }
+        size_t dir_end = checkpoints_dir + checkpoints.size();
+        size_t file_start = restart_file.rfind( PATH_SEPARATOR ) + 1;
+        if( f.hasAttr( "file_grouping" ) ) {
+            f.attr( "file_grouping", old_file_grouping );
+        } else if( file_start != dir_end ) {
+            ERROR( "Restarting with " << smpi->getSize() << " MPI processes instead of " << old_size << " requires dumps that record their file grouping" );
+        }
+        // Files of the dumped processes, with the same dump number as the restart file
+        // (a node-local restart file only holds the data of one process: the others are in restart_dir)
+        string dump_prefix = restart_file.substr( file_start, restart_file.find( '-', file_start+5 ) - file_start + 1 );
+        string rank_files_dir = restart_file.substr( 0, dir_end );
+        if( ! local_dump_dir_.empty() && ! restart_dir_.empty() && restart_file.compare( 0, local_dump_dir_.size(), local_dump_dir_ ) == 0 ) {
+            rank_files_dir = restart_dir_ + PATH_SEPARATOR + restart_file.substr( local_dump_dir_.size(), dir_end - local_dump_dir_.size() );
+        }
+        restart_rank_files_.resize( old_size );
+        for( unsigned int rk=0; rk<old_size; rk++ ) {
+            ostringstream name( "" );
+            name << rank_files_dir;
+            if( old_file_grouping > 0 ) {
+                name << setfill( '0' ) << setw( int( 1+log10( old_size/old_file_grouping+1 ) ) ) << rk/old_file_grouping << PATH_SEPARATOR;
+            }
+            name << dump_prefix << setfill( '0' ) << setw( 10 ) << rk << ".h5";
+            restart_rank_files_[rk] = name.str();
+        }
+
+        // Load of all patches, read from the files of the dumped processes shared between the current ones
+        vector<int> old_refHindexes( old_size, 0 );
+        for( unsigned int rk=1; rk<old_size; rk++ ) {
+            old_refHindexes[rk] = old_refHindexes[rk-1] + patch_count[rk-1];
+        }
+        vector<double> patch_load( old_refHindexes[old_size-1] + patch_count[old_size-1], 0. );
+        for( unsigned int rk=smpi->getRank(); rk<old_size; rk+=smpi->getSize() ) {
+            H5Read g( restart_rank_files_[rk] );
+            if( g.has( "patch_load" ) ) {
+                g.vect( "patch_load", patch_load[old_refHindexes[rk]], H5T_NATIVE_DOUBLE );
+            } else {
+                fill( patch_load.begin() + old_refHindexes[rk], patch_load.begin() + old_refHindexes[rk] + patch_count[rk], 1. );
+            }
+        }
+        MPI_Allreduce( MPI_IN_PLACE, &patch_load[0], patch_load.size(), MPI_DOUBLE, MPI_SUM, smpi->world() );
+        smpi->balance_patch_count( patch_load );
 
-    smpi->patch_refHindexes.resize( smpi->patch_count.size(), 0 );
-    smpi->patch_refHindexes[0] = 0;
-    for( int rk=1 ; rk<smpi->smilei_sz ; rk++ ) {
-        smpi->patch_refHindexes[rk] = smpi->patch_refHindexes[rk-1] + smpi->patch_count[rk-1];
+        MESSAGE( 2, "Patches dumped by " << old_size << " MPI processes distributed to " << smpi->getSize() << " processes" );
     }
 
     // load window status : required to know the patch movement
@@ -631,8 +1069,21 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     for( unsigned int j=0; j<2; j++ ) { //directions (xmin/xmax, ymin/ymax, zmin/zmax)
         for( unsigned int i=0; i<params.nDim_field; i++ ) { //axis 0=x, 1=y, 2=z
             string poy_name = Tools::merge( "Poy", Tools::xyz[i], j==0?"min":"max" );
-            if( f.hasAttr( poy_name ) ) {
-                f.attr( poy_name, vecPatches( 0 )->EMfields->poynting[j][i] );
+            if( restart_rank_files_.empty() ) {
+                if( f.hasAttr( poy_name ) ) {
+                    f.attr( poy_name, vecPatches( 0 )->EMfields->poynting[j][i] );
+                }
+            } else {
+                // Sums of the dumped processes, shared between the current ones so that the total is kept
+                vecPatches( 0 )->EMfields->poynting[j][i] = 0.;
+                for( unsigned int rk=smpi->getRank(); rk<restart_rank_files_.size(); rk+=smpi->getSize() ) {
+                    H5Read g( restart_rank_files_[rk] );
+                    double poy_val = 0.;
+                    if( g.hasAttr( poy_name ) ) {
+                        g.attr( poy_name, poy_val );
+                    }
+                    vecPatches( 0 )->EMfields->poynting[j][i] += poy_val;
+                }
             }
             k++;
         }
@@ -658,12 +1109,33 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     }
 
     // Read all the patch data
+    // (from the files of the processes which dumped them, when their number differs)
+    H5Read *rank_file = NULL;
+    unsigned int rank_file_index = 0, rank_file_start = 0, rank_file_end = 0;
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size(); ipatch++ ) {
 
+        unsigned int hindex = vecPatches( ipatch )->Hindex();
+        H5Read *file = &f;
+        if( ! restart_rank_files_.empty() ) {
+            if( ! rank_file || hindex < rank_file_start || hindex >= rank_file_end ) {
+                delete rank_file;
+                rank_file_index = 0;
+                rank_file_start = 0;
+                rank_file_end = restart_patch_count_[0];
+                while( hindex >= rank_file_end ) {
+                    rank_file_index++;
+                    rank_file_start = rank_file_end;
+                    rank_file_end += restart_patch_count_[rank_file_index];
+                }
+                rank_file = new H5Read( restart_rank_files_[rank_file_index] );
+            }
+            file = rank_file;
+        }
+
         ostringstream patch_name( "" );
-        patch_name << setfill( '0' ) << setw( 6 ) << vecPatches( ipatch )->Hindex();
+        patch_name << setfill( '0' ) << setw( 6 ) << hindex;
         string patchName = Tools::merge( "patch-", patch_name.str() );
-        H5Read g = f.group( patchName );
+        H5Read g = file->group( patchName );
 
         restartPatch( vecPatches( ipatch ), params, g );
 
@@ -671,6 +1143,7 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
         g.attr( "xorshift32_state", vecPatches( ipatch )->rand_->xorshift32_state );
 
     }
+    delete rank_file;
 
     if (params.multiple_decomposition) {
         ostringstream patch_name( "" );
@@ -681,10 +1154,15 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
     }
 
     // Read the latest Id that the MPI processes have given to each species
+    // (the processes which did not exist in the dumped simulation start their own range of Ids)
+    bool dumped_rank = restart_rank_files_.empty() || ( unsigned int )smpi->getRank() < restart_rank_files_.size();
     for( unsigned int idiag=0; idiag<vecPatches.localDiags.size(); idiag++ ) {
         if( DiagnosticTrack *track = dynamic_cast<DiagnosticTrack *>( vecPatches.localDiags[idiag] ) ) {
             ostringstream n( "" );
             n<< "latest_ID_" << track->species_name_;
+            if( ! dumped_rank ) {
+                continue;
+            }
             if( f.hasAttr( n.str() ) ) {
                 f.attr( n.str(), track->latest_Id, H5T_NATIVE_UINT64 );
             } else {
@@ -698,6 +1176,10 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, Region &region, SmileiMPI
 
 void Checkpoint::readRegionDistribution( Region &region )
 {
+    if( ! restart_rank_files_.empty() ) {
+        ERROR( "Restarting with a different number of MPI processes is not available with multiple decomposition" );
+    }
+
     int read_hindex( -1 );
 
     hid_t file = H5Fopen(restart_file.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
@@ -9,6 +9,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <thread>
 
 #include <hdf5.h>
 #include <Tools.h>
@@ -58,7 +60,10 @@ public:
     
     //! dump everything to file per processor
     void dumpAll( VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin, Params &params );
-    void dumpPatch( Patch *patch, Params &params, H5Write &g );
+    void dumpPatch( Patch *patch, Params &params, H5Write &g, bool link_frozen = false );
+    
+    //! wait until the last checkpoint written in the background is on disk
+    void waitDump();
     
     //! incremental number of times we've done a dump
     unsigned int dump_number;
@@ -93,6 +98,12 @@ public:
     //! exit once dump done
     bool exit_after_dump;
     
+    //! write the checkpoint files in the background, from a copy in memory
+    bool async_dump;
+    
+    //! link the particles of frozen species to a base file instead of writing them in each dump
+    bool incremental_dump;
+    
 private:
 
     //! initialize the time zero of the simulation
@@ -106,6 +117,8 @@ private:
     //! dump/restart a particles object
     void dumpParticles( H5Write& s, Particles &p );
     void restartParticles( H5Read& s, Particles &p );
+    //! write the content of the checkpoint file (and, if compressed, the sizes of its data uncompressed and stored)
+    void dumpFile( H5Write &f, double sizes[2], VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin, Params &params );
     //! dump/restart moving window parameters
     void dumpMovingWindow( H5Write &f, SimWindow *simWindow );
     void restartMovingWindow( H5Read &f, SimWindow *simWindow );
@@ -124,15 +137,77 @@ private:
     //! write dump drectory
     std::string dump_dir;
     
-    //! int deflate dump value
+    //! node-local directory where the checkpoint files are written first, then copied to dump_dir by
+    //! dump_writer_ (empty if none; otherwise ends with a separator and prefixes dump_dir)
+    std::string local_dump_dir_;
+    
+    //! directory of the previous run, where the files of all its processes are found
+    std::string restart_dir_;
+    
+    //! int deflate dump value (level of the compression)
     int dump_deflate;
     
+    //! compressor of the checkpoint files ("zstd", "lz4" or "deflate"; empty if none)
+    std::string dump_compression_;
+    
     //! group checkpoint files in subdirs of file_grouping files
     unsigned int file_grouping;
     
     //! restart file
     std::string restart_file;
     
+    //! when restarting with a different number of MPI processes: the patch count and the files of the dumped processes
+    std::vector<int> restart_patch_count_;
+    std::vector<std::string> restart_rank_files_;
+    
+    //! in-memory images of the checkpoint files: one is filled while the other is written
+    std::vector<char> dump_image_[2];
+    
+    //! index of the image filled by the next asynchronous dump
+    unsigned int dump_image_index_;
+    
+    //! thread writing the last image on disk
+    std::thread dump_writer_;
+    
+    //! name of the file written by dump_writer_, and whether it failed
+    std::string dump_writer_file_;
+    bool dump_writer_failed_;
+    
+    //! files copied by dump_writer_ from the node-local directory to dump_dir
+    std::vector<std::string> dump_writer_drain_;
+    
+    //! hash and group of the particles of a species in a patch (the key is the patch index and the species number)
+    struct FrozenParticles {
+        uint64_t hash;
+        std::string group;
+        std::vector<std::string> datasets;
+    };
+    
+    //! frozen particles of the current dump, and those stored in the current base file
+    std::map<std::pair<unsigned int, unsigned int>, FrozenParticles> frozen_particles_;
+    std::map<std::pair<unsigned int, unsigned int>, FrozenParticles> base_particles_;
+    
+    //! current base file (name relative to the dump directory, and number of the dump which created it; -1 if none)
+    std::string base_name_;
+    int base_id_;
+    
+    //! base files created by this run or used by the kept dumps of the previous runs (full path), the base used by each kept dump,
+    //! and the base of the dump being replaced by the file written in the background
+    std::map<int, std::string> base_files_;
+    std::vector<int> dump_base_;
+    int replaced_base_;
+    
+    //! hash the frozen particles, and write a new base file when the current one is outdated
+    void prepareBase( std::string dir, VectorPatch &vecPatches, SmileiMPI *smpi, double time );
+    //! link the particles of a species to the current base file, if unchanged
+    bool linkFrozenParticles( H5Write &s, unsigned int hindex, unsigned int ispec );
+    //! remove the base files that no kept dump uses
+    void cleanBaseFiles();
+    //! at restart, find the base files used by the dumps kept in the checkpoints directory
+    void restartBaseFiles( SmileiMPI *smpi );
+    //! directory of the checkpoint files of this process, relative to the simulation directory
+    std::string dumpDirectory( SmileiMPI *smpi );
+    
     //! dump PML in the checkpoint file 
     template <typename Tpml>
     void  dump_PML(Tpml embc, H5Write &g );
@@ -185,6 +185,24 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI *smpi, VectorPatch
         ERROR( "Diagnostic Fields #"<<ndiag<<" has an unknown datatype `"<<datatype<<"`" );
     }
     
+    // Extract the compression
+    compression_ = "";
+    compression_level_ = 0;
+    PyTools::extractOrNone( "compression", compression_, "DiagFields", ndiag );
+    PyTools::extract( "compression_level", compression_level_, "DiagFields", ndiag );
+    if( ! compression_.empty() ) {
+        if( compression_ != "zstd" && compression_ != "lz4" && compression_ != "deflate" ) {
+            ERROR( "Diagnostic Fields #"<<ndiag<<" has an unknown compression `"<<compression_<<"` (must be `zstd`, `lz4` or `deflate`)" );
+        }
+#if ! H5_VERSION_GE( 1, 10, 2 )
+        WARNING( "Diagnostic Fields #"<<ndiag<<": compression requires HDF5 1.10.2 or newer (parallel filters). Not compressed" );
+        compression_ = "";
+#endif
+    }
+    compression_sizes_[0] = 0.;
+    compression_sizes_[1] = 0.;
+    compression_time_ = 0.;
+    
     // Copy the total number of patches
     tot_number_of_patches = params.tot_number_of_patches;
     
@@ -207,6 +225,18 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI *smpi, VectorPatch
 }
 
 
+void DiagnosticFields::compressionChunks( vector<hsize_t> &chunk_size, vector<hsize_t> &final_array_size )
+{
+    if( compression_.empty() ) {
+        return;
+    }
+    chunk_size.resize( final_array_size.size() );
+    for( unsigned int i=0; i<final_array_size.size(); i++ ) {
+        chunk_size[i] = min( final_array_size[i], ( hsize_t ) max( 1u, patch_size_[i] / subgrid_step_[i] ) );
+    }
+}
+
+
 DiagnosticFields::~DiagnosticFields()
 {
     closeFile();
@@ -234,6 +264,11 @@ void DiagnosticFields::openFile( Params &, SmileiMPI *smpi )
     // Attributes for openPMD
     openPMD_->writeRootAttributes( *file_, ".", "no_particles" );
     
+    // Compress the datasets created in this file
+    if( ! compression_.empty() ) {
+        file_->compression( compression_, compression_level_ );
+    }
+    
     // Make main "data" group where everything will be stored (required by openPMD)
     data_group_ = new H5Write( file_, "data" );
     
@@ -242,6 +277,13 @@ void DiagnosticFields::openFile( Params &, SmileiMPI *smpi )
 
 void DiagnosticFields::closeFile()
 {
+    if( compression_sizes_[1] > 0. ) {
+        MESSAGE( 1, "Diagnostic Fields #"<<diag_n<<": compression ratio " << compression_sizes_[0] / compression_sizes_[1]
+                 << ", " << compression_sizes_[0] / std::max( compression_time_, 1e-9 ) / 1048576. << " MB/s of uncompressed data" );
+        compression_sizes_[0] = 0.;
+        compression_sizes_[1] = 0.;
+        compression_time_ = 0.;
+    }
     if( data_group_ ) {
         delete data_group_;
         data_group_ = NULL;
@@ -333,7 +375,9 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         #pragma omp master
         {
             // Write
+            double write_time = MPI_Wtime();
             H5Write dset = writeField( iteration_group_, fields_names[ifield] );
+            compression_time_ += MPI_Wtime() - write_time;
             // Attributes for openPMD
             Field *f = vecPatches( 0 )->EMfields->allFields[fields_indexes[ifield]];
             vector<double> stagger( f->dims().size() );
@@ -356,6 +400,13 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         // write x_moved
         double x_moved = simWindow ? simWindow->getXmoved() : 0.;
         iteration_group_->attr( "x_moved", x_moved );
+        // Sizes of the fields of this iteration, uncompressed and stored
+        if( ! compression_.empty() ) {
+            hsize_t raw, stored;
+            iteration_group_->storageSize( raw, stored );
+            compression_sizes_[0] += raw;
+            compression_sizes_[1] += stored;
+        }
         delete iteration_group_;
         if( flush_timeSelection->theTimeIsNow( itime ) ) {
             file_->flush();
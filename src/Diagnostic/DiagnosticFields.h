@@ -101,6 +101,17 @@ protected :
     
     //! Datatype for writing to HDF5 file
     hid_t file_datatype_;
+    
+    //! Compressor of the file ("zstd", "lz4" or "deflate"; empty if none) and its level
+    std::string compression_;
+    int compression_level_;
+    
+    //! Sizes of the data written (uncompressed and stored) and time spent writing it
+    double compression_sizes_[2];
+    double compression_time_;
+    
+    //! When compressed, make the chunks of the file the size of a patch (filters require chunks)
+    void compressionChunks( std::vector<hsize_t> &chunk_size, std::vector<hsize_t> &final_array_size );
 };
 
 #endif
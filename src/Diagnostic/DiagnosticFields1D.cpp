@@ -62,8 +62,14 @@ void DiagnosticFields1D::setFileSplitting( SmileiMPI *smpi, VectorPatch &vecPatc
     
     data.resize( nsteps );
     
+    // When compressed, chunks the size of a patch
+    hsize_t chunk = 0;
+    if( ! compression_.empty() ) {
+        chunk = min( ( hsize_t ) total_dataset_size, ( hsize_t ) max( 1u, total_patch_size / subgrid_step_[0] ) );
+    }
+    
     delete filespace;
-    filespace = new H5Space( total_dataset_size, MPI_start_in_file, nsteps );
+    filespace = new H5Space( total_dataset_size, MPI_start_in_file, nsteps, chunk );
     delete memspace;
     memspace = new H5Space( total_dataset_size, 0, nsteps );
 }
@@ -48,6 +48,8 @@ DiagnosticFields3D::DiagnosticFields3D( Params &params, SmileiMPI *smpi, VectorP
         }
     }
     
+    compressionChunks( chunk_size, final_array_size );
+    
     filespace = new H5Space( final_array_size, {}, {}, chunk_size );
     memspace = new H5Space( 1 );
     
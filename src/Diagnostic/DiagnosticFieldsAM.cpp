@@ -71,6 +71,11 @@ DiagnosticFieldsAM::DiagnosticFieldsAM( Params &params, SmileiMPI *smpi, VectorP
         }
     }
     
+    compressionChunks( chunk_size, final_array_size );
+    if( is_complex_ && ! chunk_size.empty() ) {
+        chunk_size[1] = min( final_array_size[1], 2*chunk_size[1] );
+    }
+    
     filespace = new H5Space( final_array_size, {}, {}, chunk_size );
     memspace = new H5Space( 1 );
     
@@ -6,7 +6,7 @@
 
 using namespace std;
 
-const unsigned int n_quantities_double = 19;
+const unsigned int n_quantities_double = 21;
 const unsigned int n_quantities_uint   = 4;
 
 // Constructor
@@ -107,6 +107,8 @@ void DiagnosticPerformances::openFile( Params &params, SmileiMPI *smpi )
     quantities_double[16] = "timer_envelope"     ;
     quantities_double[17] = "timer_syncSusceptibility"     ;
     quantities_double[18] = "timer_partMerging"     ;
+    quantities_double[19] = "sums_relative_error"   ;
+    quantities_double[20] = "sums_double_fraction"  ;
     file_->attr( "quantities_double", quantities_double );
     
     file_->flush();
@@ -140,7 +142,7 @@ bool DiagnosticPerformances::prepare( int itime )
 } // END prepare
 
 
-void DiagnosticPerformances::run( SmileiMPI *, VectorPatch &vecPatches, int itime, SimWindow *, Timers &timers )
+void DiagnosticPerformances::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime, SimWindow *, Timers &timers )
 {
     
     #pragma omp master
@@ -223,6 +225,7 @@ void DiagnosticPerformances::run( SmileiMPI *, VectorPatch &vecPatches, int itim
         quantities_double[16] = timers.envelope         .getTime();
         quantities_double[17] = timers.susceptibility   .getTime();
         quantities_double[18] = timers.particleMerging  .getTime();
+        smpi->getFloatSumsError( quantities_double[19], quantities_double[20] );
         
         // Write doubles to file
         iteration_group.array( "quantities_double", quantities_double[0], &filespace_double, &memspace_double );
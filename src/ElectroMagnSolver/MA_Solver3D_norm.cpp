@@ -4,19 +4,43 @@
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
+#include <algorithm>
+
 MA_Solver3D_norm::MA_Solver3D_norm( Params &params )
     : Solver3D( params )
 {
-    // EMPTY
+    tile_size_ = params.maxwell_tile_size;
+    faraday_ = params.maxwell_temporal_blocking ? new MF_Solver3D_Yee( params ) : NULL;
 }
 
 MA_Solver3D_norm::~MA_Solver3D_norm()
 {
-    // EMPTY
+    delete faraday_;
 }
 
 void MA_Solver3D_norm::operator()( ElectroMagn *fields )
 {
+    if( tile_size_ > 0 ) {
+        // The three components are updated together, one x-plane of a tile after the other.
+        // The tiles span all the cells in z, so that the inner loops stay long.
+        // The E stencil only reads B at the same or upper indices, and the B stencil only reads E
+        // at the same or lower indices: the planes of B can be advanced right after those of E
+        // (sweeping the tiles and the planes by increasing indices) without changing the result.
+        const unsigned int nx_d = fields->dimDual[0];
+        const unsigned int ny_d = fields->dimDual[1];
+        const unsigned int nz_d = fields->dimDual[2];
+        for( unsigned int j0=0 ; j0<ny_d ; j0+=tile_size_ ) {
+            const unsigned int j1 = std::min( j0+tile_size_, ny_d );
+            for( unsigned int i=0 ; i<nx_d ; i++ ) {
+                tilePlane( fields, i, j0, j1, 0, nz_d );
+                if( faraday_ ) {
+                    faraday_->tilePlane( fields, i, j0, j1, 0, nz_d, true );
+                }
+            }
+        }
+        return;
+    }
+
     double *const __restrict__ Ex3D       = fields->Ex_->data();
     double *const __restrict__ Ey3D       = fields->Ey_->data();
     double *const __restrict__ Ez3D       = fields->Ez_->data();
@@ -113,3 +137,68 @@ void MA_Solver3D_norm::operator()( ElectroMagn *fields )
         }
     }
 }
+
+void MA_Solver3D_norm::tilePlane( ElectroMagn *fields, unsigned int i,
+                                  unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1 )
+{
+    double *const __restrict__ Ex3D       = fields->Ex_->data();
+    double *const __restrict__ Ey3D       = fields->Ey_->data();
+    double *const __restrict__ Ez3D       = fields->Ez_->data();
+    const double *const __restrict__ Bx3D = fields->Bx_->data();
+    const double *const __restrict__ By3D = fields->By_->data();
+    const double *const __restrict__ Bz3D = fields->Bz_->data();
+    const double *const __restrict__ Jx3D = fields->Jx_->data();
+    const double *const __restrict__ Jy3D = fields->Jy_->data();
+    const double *const __restrict__ Jz3D = fields->Jz_->data();
+
+    const unsigned int nx_p = fields->dimPrim[0];
+    const unsigned int ny_p = fields->dimPrim[1];
+    const unsigned int ny_d = fields->dimDual[1];
+    const unsigned int nz_p = fields->dimPrim[2];
+    const unsigned int nz_d = fields->dimDual[2];
+
+    // Bounds of the tile on the primal grid
+    const unsigned int j1_p = std::min( j1, ny_p );
+    const unsigned int k1_p = std::min( k1, nz_p );
+
+    // The rows are addressed through pointers so that the k loops vectorize
+
+    // Electric field Ex^(d,p,p)
+    for( unsigned int j=j0 ; j<j1_p ; j++ ) {
+        double *const __restrict__ ex       = Ex3D + i*(ny_p*nz_p) + j*(nz_p);
+        const double *const __restrict__ jx = Jx3D + i*(ny_p*nz_p) + j*(nz_p);
+        const double *const __restrict__ bz = Bz3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ by = By3D + i*(ny_p*nz_d) + j*(nz_d);
+        for( unsigned int k=k0 ; k<k1_p ; k++ ) {
+            ex[k] += -dt*jx[k] + dt_ov_dy * ( bz[k+nz_p] - bz[k] ) - dt_ov_dz * ( by[k+1] - by[k] );
+        }
+    }
+
+    if( i>=nx_p ) {
+        return;
+    }
+
+    // Electric field Ey^(p,d,p)
+    for( unsigned int j=j0 ; j<j1 ; j++ ) {
+        double *const __restrict__ ey        = Ey3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ jy  = Jy3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ bz  = Bz3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ bzp = Bz3D + (i+1)*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ bx  = Bx3D + i*(ny_d*nz_d) + j*(nz_d);
+        for( unsigned int k=k0 ; k<k1_p ; k++ ) {
+            ey[k] += -dt*jy[k] - dt_ov_dx * ( bzp[k] - bz[k] ) + dt_ov_dz * ( bx[k+1] - bx[k] );
+        }
+    }
+
+    // Electric field Ez^(p,p,d)
+    for( unsigned int j=j0 ; j<j1_p ; j++ ) {
+        double *const __restrict__ ez        = Ez3D + i*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ jz  = Jz3D + i*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ by  = By3D + i*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ byp = By3D + (i+1)*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ bx  = Bx3D + i*(ny_d*nz_d) + j*(nz_d);
+        for( unsigned int k=k0 ; k<k1 ; k++ ) {
+            ez[k] += -dt*jz[k] + dt_ov_dx * ( byp[k] - by[k] ) - dt_ov_dy * ( bx[k+nz_d] - bx[k] );
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #define MA_SOLVER3D_NORM_H
 
 #include "Solver3D.h"
+#include "MF_Solver3D_Yee.h"
 class ElectroMagn;
 
 //  --------------------------------------------------------------------------------------------------------------------
@@ -18,6 +19,15 @@ public:
     virtual void operator()( ElectroMagn *fields );
     
 protected:
+    //! Updates Ex, Ey and Ez on the plane i of the tile [j0,j1[ x [k0,k1[ (bounds on the dual grid)
+    void tilePlane( ElectroMagn *fields, unsigned int i,
+                    unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1 );
+
+    //! Size of the tiles in the y direction (0 = no tiling)
+    unsigned int tile_size_;
+
+    //! Faraday solver applied to each plane of a tile right after the Ampere update (temporal blocking), or NULL
+    MF_Solver3D_Yee *faraday_;
 
 };//END class
 
@@ -4,6 +4,8 @@
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
+#include <algorithm>
+
 MF_Solver2D_Yee::MF_Solver2D_Yee( Params &params )
     : Solver2D( params )
 {
@@ -99,3 +101,71 @@ void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
         }
     }
 }
+
+void MF_Solver2D_Yee::box( ElectroMagn *fields, unsigned int i0, unsigned int i1, unsigned int j0, unsigned int j1 )
+{
+    const unsigned int nx_p = fields->dimPrim[0];
+    const unsigned int nx_d = fields->dimDual[0];
+    const unsigned int ny_p = fields->dimPrim[1];
+    const unsigned int ny_d = fields->dimDual[1];
+
+    const double *const __restrict__ Ex2D = isEFilterApplied ? fields->filter_->Ex_[0]->data() : fields->Ex_->data();
+    const double *const __restrict__ Ey2D = isEFilterApplied ? fields->filter_->Ey_[0]->data() : fields->Ey_->data();
+    const double *const __restrict__ Ez2D = fields->Ez_->data();
+    double *const __restrict__ Bx2D       = fields->Bx_->data();
+    double *const __restrict__ By2D       = fields->By_->data();
+    double *const __restrict__ Bz2D       = fields->Bz_->data();
+
+    // Bounds of the box on the points updated by operator()
+    const unsigned int i1_p = std::min( i1, nx_p );
+    const unsigned int i0_d = std::max( i0, 1u );
+    const unsigned int i1_d = std::min( i1, nx_d-1 );
+    const unsigned int j1_p = std::min( j1, ny_p );
+    const unsigned int j0_d = std::max( j0, 1u );
+    const unsigned int j1_d = std::min( j1, ny_d-1 );
+
+    // Magnetic field Bx^(p,d)
+    for( unsigned int x = i0; x < i1_p; ++x ) {
+        #pragma omp simd
+        for( unsigned int y = j0_d; y < j1_d; ++y ) {
+            Bx2D[x * ny_d + y] -= dt_ov_dy * ( Ez2D[x * ny_p + y] - Ez2D[x * ny_p + y - 1] );
+        }
+    }
+    // Magnetic field By^(d,p)
+    for( unsigned int x = i0_d; x < i1_d; ++x ) {
+        #pragma omp simd
+        for( unsigned int y = j0; y < j1_p; ++y ) {
+            By2D[x * ny_p + y] += dt_ov_dx * ( Ez2D[x * ny_p + y] - Ez2D[( x - 1 ) * ny_p + y] );
+        }
+    }
+    // Magnetic field Bz^(d,d)
+    for( unsigned int x = i0_d; x < i1_d; ++x ) {
+        #pragma omp simd
+        for( unsigned int y = j0_d; y < j1_d; ++y ) {
+            Bz2D[x * ny_d + y] += dt_ov_dy * ( Ex2D[x * ny_p + y] - Ex2D[x * ny_p + y - 1] ) -
+                                  dt_ov_dx * ( Ey2D[x * ny_d + y] - Ey2D[( x - 1 ) * ny_d + y] );
+        }
+    }
+}
+
+void MF_Solver2D_Yee::boundaryLayers( ElectroMagn *fields )
+{
+    unsigned int bx[4], by[4];
+    splitBoundaryLayers( fields->dimDual[0], fields->oversize[0], bx );
+    splitBoundaryLayers( fields->dimDual[1], fields->oversize[1], by );
+
+    // The layers do not intersect : x layers on the whole patch, then y layers inside the x interior
+    box( fields, bx[0], bx[1], by[0], by[3] );
+    box( fields, bx[2], bx[3], by[0], by[3] );
+    box( fields, bx[1], bx[2], by[0], by[1] );
+    box( fields, bx[1], bx[2], by[2], by[3] );
+}
+
+void MF_Solver2D_Yee::interior( ElectroMagn *fields )
+{
+    unsigned int bx[4], by[4];
+    splitBoundaryLayers( fields->dimDual[0], fields->oversize[0], bx );
+    splitBoundaryLayers( fields->dimDual[1], fields->oversize[1], by );
+
+    box( fields, bx[1], bx[2], by[1], by[2] );
+}
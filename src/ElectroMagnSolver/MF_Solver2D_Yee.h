@@ -18,7 +18,14 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields );
     
+    //! Updates B on the layers sent to the neighbor patches, or on the rest of the patch
+    virtual void boundaryLayers( ElectroMagn *fields );
+    virtual void interior( ElectroMagn *fields );
+    
 protected:
+    //! Updates B on the box [i0,i1[ x [j0,j1[ (bounds on the dual grid)
+    void box( ElectroMagn *fields, unsigned int i0, unsigned int i1, unsigned int j0, unsigned int j1 );
+    
     // Check if time filter is applied or not
     bool isEFilterApplied;
     
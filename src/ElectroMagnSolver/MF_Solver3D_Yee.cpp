@@ -4,10 +4,13 @@
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
+#include <algorithm>
+
 MF_Solver3D_Yee::MF_Solver3D_Yee( Params &params )
     : Solver3D( params )
 {
     isEFilterApplied = params.Friedman_filter;
+    tile_size_ = params.maxwell_tile_size;
 }
 
 MF_Solver3D_Yee::~MF_Solver3D_Yee()
@@ -17,6 +20,21 @@ MF_Solver3D_Yee::~MF_Solver3D_Yee()
 
 void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
 {
+    if( tile_size_ > 0 ) {
+        // The three components are updated together, one x-plane of a tile after the other.
+        // The tiles span all the cells in z, so that the inner loops stay long.
+        const unsigned int nx_d = fields->dimDual[0];
+        const unsigned int ny_d = fields->dimDual[1];
+        const unsigned int nz_d = fields->dimDual[2];
+        for( unsigned int j0=0 ; j0<ny_d ; j0+=tile_size_ ) {
+            const unsigned int j1 = std::min( j0+tile_size_, ny_d );
+            for( unsigned int i=0 ; i<nx_d ; i++ ) {
+                tilePlane( fields, i, j0, j1, 0, nz_d, false );
+            }
+        }
+        return;
+    }
+
     // Static-cast of the fields
     double *const __restrict__ Bx3D       = fields->Bx_->data();
     double *const __restrict__ By3D       = fields->By_->data();
@@ -109,3 +127,126 @@ void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
         }
     }
 }
+
+void MF_Solver3D_Yee::tilePlane( ElectroMagn *fields, unsigned int i,
+                                 unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, bool save_B_m )
+{
+    double *const __restrict__ Bx3D = fields->Bx_->data();
+    double *const __restrict__ By3D = fields->By_->data();
+    double *const __restrict__ Bz3D = fields->Bz_->data();
+    const double *const __restrict__ Ex3D = isEFilterApplied ? fields->filter_->Ex_[0]->data() : fields->Ex_->data();
+    const double *const __restrict__ Ey3D = isEFilterApplied ? fields->filter_->Ey_[0]->data() : fields->Ey_->data();
+    const double *const __restrict__ Ez3D = isEFilterApplied ? fields->filter_->Ez_[0]->data() : fields->Ez_->data();
+
+    const unsigned int nx_p = fields->dimPrim[0];
+    const unsigned int nx_d = fields->dimDual[0];
+    const unsigned int ny_p = fields->dimPrim[1];
+    const unsigned int ny_d = fields->dimDual[1];
+    const unsigned int nz_p = fields->dimPrim[2];
+    const unsigned int nz_d = fields->dimDual[2];
+
+    // Bounds of the tile on the primal grid
+    const unsigned int j1_p = std::min( j1, ny_p );
+    const unsigned int k1_p = std::min( k1, nz_p );
+    // Bounds of the tile on the interior of the dual grid
+    const unsigned int j0_d = std::max( j0, 1u );
+    const unsigned int j1_d = std::min( j1, ny_d-1 );
+    const unsigned int k0_d = std::max( k0, 1u );
+    const unsigned int k1_d = std::min( k1, nz_d-1 );
+
+    // The rows are addressed through pointers so that the k loops vectorize
+    if( save_B_m ) {
+        double *const __restrict__ Bx3D_m = fields->Bx_m->data();
+        double *const __restrict__ By3D_m = fields->By_m->data();
+        double *const __restrict__ Bz3D_m = fields->Bz_m->data();
+        if( i<nx_p ) {
+            for( unsigned int j=j0 ; j<j1 ; j++ ) {
+                std::copy( Bx3D + i*(ny_d*nz_d) + j*(nz_d) + k0, Bx3D + i*(ny_d*nz_d) + j*(nz_d) + k1, Bx3D_m + i*(ny_d*nz_d) + j*(nz_d) + k0 );
+            }
+        }
+        for( unsigned int j=j0 ; j<j1_p ; j++ ) {
+            std::copy( By3D + i*(ny_p*nz_d) + j*(nz_d) + k0, By3D + i*(ny_p*nz_d) + j*(nz_d) + k1, By3D_m + i*(ny_p*nz_d) + j*(nz_d) + k0 );
+        }
+        for( unsigned int j=j0 ; j<j1 ; j++ ) {
+            std::copy( Bz3D + i*(ny_d*nz_p) + j*(nz_p) + k0, Bz3D + i*(ny_d*nz_p) + j*(nz_p) + k1_p, Bz3D_m + i*(ny_d*nz_p) + j*(nz_p) + k0 );
+        }
+    }
+
+    // Magnetic field Bx^(p,d,d)
+    if( i<nx_p ) {
+        for( unsigned int j=j0_d ; j<j1_d ; j++ ) {
+            double *const __restrict__ bx        = Bx3D + i*(ny_d*nz_d) + j*(nz_d);
+            const double *const __restrict__ ez  = Ez3D + i*(ny_p*nz_d) + j*(nz_d);
+            const double *const __restrict__ ezm = Ez3D + i*(ny_p*nz_d) + (j-1)*(nz_d);
+            const double *const __restrict__ ey  = Ey3D + i*(ny_d*nz_p) + j*(nz_p);
+            for( unsigned int k=k0_d ; k<k1_d ; k++ ) {
+                bx[k] += -dt_ov_dy * ( ez[k] - ezm[k] ) + dt_ov_dz * ( ey[k] - ey[k-1] );
+            }
+        }
+    }
+
+    if( i<1 || i>=nx_d-1 ) {
+        return;
+    }
+
+    // Magnetic field By^(d,p,d)
+    for( unsigned int j=j0 ; j<j1_p ; j++ ) {
+        double *const __restrict__ by        = By3D + i*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ ex  = Ex3D + i*(ny_p*nz_p) + j*(nz_p);
+        const double *const __restrict__ ez  = Ez3D + i*(ny_p*nz_d) + j*(nz_d);
+        const double *const __restrict__ ezm = Ez3D + (i-1)*(ny_p*nz_d) + j*(nz_d);
+        for( unsigned int k=k0_d ; k<k1_d ; k++ ) {
+            by[k] += -dt_ov_dz * ( ex[k] - ex[k-1] ) + dt_ov_dx * ( ez[k] - ezm[k] );
+        }
+    }
+
+    // Magnetic field Bz^(d,d,p)
+    for( unsigned int j=j0_d ; j<j1_d ; j++ ) {
+        double *const __restrict__ bz        = Bz3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ ey  = Ey3D + i*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ eym = Ey3D + (i-1)*(ny_d*nz_p) + j*(nz_p);
+        const double *const __restrict__ ex  = Ex3D + i*(ny_p*nz_p) + j*(nz_p);
+        const double *const __restrict__ exm = Ex3D + i*(ny_p*nz_p) + (j-1)*(nz_p);
+        for( unsigned int k=k0 ; k<k1_p ; k++ ) {
+            bz[k] += -dt_ov_dx * ( ey[k] - eym[k] ) + dt_ov_dy * ( ex[k] - exm[k] );
+        }
+    }
+}
+
+void MF_Solver3D_Yee::box( ElectroMagn *fields, unsigned int i0, unsigned int i1,
+                           unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1 )
+{
+    const unsigned int tile = tile_size_ > 0 ? tile_size_ : j1-j0;
+    for( unsigned int jt0=j0 ; jt0<j1 ; jt0+=tile ) {
+        const unsigned int jt1 = std::min( jt0+tile, j1 );
+        for( unsigned int i=i0 ; i<i1 ; i++ ) {
+            tilePlane( fields, i, jt0, jt1, k0, k1, false );
+        }
+    }
+}
+
+void MF_Solver3D_Yee::boundaryLayers( ElectroMagn *fields )
+{
+    unsigned int bx[4], by[4], bz[4];
+    splitBoundaryLayers( fields->dimDual[0], fields->oversize[0], bx );
+    splitBoundaryLayers( fields->dimDual[1], fields->oversize[1], by );
+    splitBoundaryLayers( fields->dimDual[2], fields->oversize[2], bz );
+
+    // The layers do not intersect : x layers on the whole plane, then y layers and z layers inside the x interior
+    box( fields, bx[0], bx[1], by[0], by[3], bz[0], bz[3] );
+    box( fields, bx[2], bx[3], by[0], by[3], bz[0], bz[3] );
+    box( fields, bx[1], bx[2], by[0], by[1], bz[0], bz[3] );
+    box( fields, bx[1], bx[2], by[2], by[3], bz[0], bz[3] );
+    box( fields, bx[1], bx[2], by[1], by[2], bz[0], bz[1] );
+    box( fields, bx[1], bx[2], by[1], by[2], bz[2], bz[3] );
+}
+
+void MF_Solver3D_Yee::interior( ElectroMagn *fields )
+{
+    unsigned int bx[4], by[4], bz[4];
+    splitBoundaryLayers( fields->dimDual[0], fields->oversize[0], bx );
+    splitBoundaryLayers( fields->dimDual[1], fields->oversize[1], by );
+    splitBoundaryLayers( fields->dimDual[2], fields->oversize[2], bz );
+
+    box( fields, bx[1], bx[2], by[1], by[2], bz[1], bz[2] );
+}
@@ -18,10 +18,26 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields );
 
+    //! Updates Bx, By and Bz on the plane i of the tile [j0,j1[ x [k0,k1[ (bounds on the dual grid)
+    //! When save_B_m, B is first copied to B_m on the same points (including the ghost cells)
+    void tilePlane( ElectroMagn *fields, unsigned int i,
+                    unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1, bool save_B_m );
+
+    //! Updates B on the layers sent to the neighbor patches, or on the rest of the patch
+    virtual void boundaryLayers( ElectroMagn *fields );
+    virtual void interior( ElectroMagn *fields );
+
 protected:
+    //! Updates B on the box [i0,i1[ x [j0,j1[ x [k0,k1[ (bounds on the dual grid), by tiles if tile_size_ > 0
+    void box( ElectroMagn *fields, unsigned int i0, unsigned int i1,
+              unsigned int j0, unsigned int j1, unsigned int k0, unsigned int k1 );
+
     // Check if time filter is applied or not
     bool isEFilterApplied;
 
+    //! Size of the tiles in the y direction (0 = no tiling)
+    unsigned int tile_size_;
+
 };//END class
 
 #endif
@@ -29,8 +29,30 @@ public:
     virtual void compute_H_from_B( ElectroMagn *, int, int, std::vector<unsigned int>, unsigned int, unsigned int ) {ERROR("Not using PML");};
     virtual void compute_A_from_G( LaserEnvelope *, int, int, std::vector<unsigned int>, unsigned int, unsigned int ) {ERROR("Not using PML");};
 
+    //! Updates the fields only on the layers of the patch sent to its neighbors, or only on the rest of the patch
+    //! (see Main.maxwell_overlap_communications)
+    virtual void boundaryLayers( ElectroMagn * ) {ERROR("Not available for this solver");};
+    virtual void interior( ElectroMagn * ) {ERROR("Not available for this solver");};
+
 protected:
 
+    //! Splits [0,n[ (dual grid) into the lower layer [bounds[0],bounds[1][, the interior [bounds[1],bounds[2][
+    //! and the upper layer [bounds[2],bounds[3][. The layers contain the cells sent to the neighbors.
+    //! When the patch is too small, the whole range is in the lower layer.
+    static void splitBoundaryLayers( unsigned int n, unsigned int oversize, unsigned int bounds[4] )
+    {
+        const unsigned int width = 2*oversize+2;
+        bounds[0] = 0;
+        bounds[3] = n;
+        if( 2*width < n ) {
+            bounds[1] = width;
+            bounds[2] = n-width;
+        } else {
+            bounds[1] = n;
+            bounds[2] = n;
+        }
+    }
+
 };//END class
 
 class NullSolver : public Solver
@@ -161,7 +161,10 @@ public:
 
         } else if( params.geometry == "3Dcartesian" ) {
 
-            if( params.maxwell_sol == "Yee" ) {
+            if( params.maxwell_temporal_blocking ) {
+                // Faraday is done by MA_Solver3D_norm in the same sweep
+                solver = new NullSolver();
+            } else if( params.maxwell_sol == "Yee" ) {
                 solver = new MF_Solver3D_Yee( params );
             } else if( params.maxwell_sol == "Lehe" ) {
                 solver = new MF_Solver3D_Lehe( params );
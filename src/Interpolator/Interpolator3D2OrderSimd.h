@@ -0,0 +1,106 @@
+#ifndef INTERPOLATOR3D2ORDERSIMD_H
+#define INTERPOLATOR3D2ORDERSIMD_H
+
+#include "Simd.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Explicit-SIMD stencil of Interpolator3D2OrderV::fieldsInBuffers (config=simd_kernels)
+//! One call interpolates one field component for the (at most 32) particles of a block:
+//!  - coeff[d][dual][node][ipart] are the coefficients of the 3 nodes in the direction d (primal or dual grid)
+//!  - dual[d][ipart] is 1 when the particle is on the upper half of the dual cell in the direction d
+//!  - field_buffer holds the 4x4x4 values of the field around the cell
+//! The template parameters give the directions in which the component is defined on the dual grid.
+//! The operations are done in the same order as the `#pragma omp simd` loops (see Simd.h for the round-off).
+//  --------------------------------------------------------------------------------------------------------------------
+
+namespace smilei {
+    namespace tools {
+        namespace simd {
+
+            //! Value of the field seen by the lanes of the vector at the node (i,j,k) of the stencil
+            template<typename V, int dual_x, int dual_y, int dual_z>
+            inline V stencilField( const double ( *field_buffer )[4][4], int i, int j, int k,
+                                   typename V::Mask mask_x, typename V::Mask mask_y, typename V::Mask mask_z )
+            {
+                // Shift of one node in the dual directions (a select is exact, unlike the (1-d)*a+d*b blend)
+                V f00 = dual_x ? V::select( mask_x, V( field_buffer[i][j][k] ), V( field_buffer[i+1][j][k] ) )
+                                 : V( field_buffer[i][j][k] );
+                if( dual_y ) {
+                    V f10 = dual_x ? V::select( mask_x, V( field_buffer[i][j+1][k] ), V( field_buffer[i+1][j+1][k] ) )
+                                     : V( field_buffer[i][j+1][k] );
+                    f00 = V::select( mask_y, f00, f10 );
+                }
+                if( dual_z ) {
+                    V f01 = dual_x ? V::select( mask_x, V( field_buffer[i][j][k+1] ), V( field_buffer[i+1][j][k+1] ) )
+                                     : V( field_buffer[i][j][k+1] );
+                    if( dual_y ) {
+                        V f11 = dual_x ? V::select( mask_x, V( field_buffer[i][j+1][k+1] ), V( field_buffer[i+1][j+1][k+1] ) )
+                                         : V( field_buffer[i][j+1][k+1] );
+                        f01 = V::select( mask_y, f01, f11 );
+                    }
+                    f00 = V::select( mask_z, f00, f01 );
+                }
+                return f00;
+            }
+
+            //! Interpolation for the V::width particles starting at ipart
+            template<typename V, int dual_x, int dual_y, int dual_z>
+            inline void interpolate3D2OrderLanes( const double ( *coeff )[2][3][32], const int ( *dual )[32],
+                                                  const double ( *field_buffer )[4][4], int ipart, double *out )
+            {
+                typename V::Mask mask_x = typename V::Mask(), mask_y = typename V::Mask(), mask_z = typename V::Mask();
+                if( dual_x ) {
+                    mask_x = V::nonZero( &dual[0][ipart] );
+                }
+                if( dual_y ) {
+                    mask_y = V::nonZero( &dual[1][ipart] );
+                }
+                if( dual_z ) {
+                    mask_z = V::nonZero( &dual[2][ipart] );
+                }
+
+                V interp_res( 0. );
+                for( int iloc=0 ; iloc<3 ; iloc++ ) {
+                    const V cx = V::load( &coeff[0][dual_x][iloc][ipart] );
+                    for( int jloc=0 ; jloc<3 ; jloc++ ) {
+                        const V cxy = cx * V::load( &coeff[1][dual_y][jloc][ipart] );
+                        for( int kloc=0 ; kloc<3 ; kloc++ ) {
+                            interp_res = interp_res + cxy * V::load( &coeff[2][dual_z][kloc][ipart] )
+                                         * stencilField<V, dual_x, dual_y, dual_z>( field_buffer, iloc, jloc, kloc, mask_x, mask_y, mask_z );
+                        }
+                    }
+                }
+                interp_res.store( out + ipart );
+            }
+
+            //! Interpolation of one field component for the np particles of a block (np <= 32)
+            template<int dual_x, int dual_y, int dual_z>
+            inline void interpolate3D2Order( const double ( *coeff )[2][3][32], const int ( *dual )[32],
+                                             const double ( *field_buffer )[4][4], int np, double *out )
+            {
+                int ipart = 0;
+                for( ; ipart + Vector::width <= np ; ipart += Vector::width ) {
+                    interpolate3D2OrderLanes<Vector, dual_x, dual_y, dual_z>( coeff, dual, field_buffer, ipart, out );
+                }
+                for( ; ipart < np ; ipart++ ) {
+                    interpolate3D2OrderLanes<Scalar, dual_x, dual_y, dual_z>( coeff, dual, field_buffer, ipart, out );
+                }
+            }
+
+            //! Same as above for the buffers of the mixed-precision mode
+            template<int dual_x, int dual_y, int dual_z>
+            inline void interpolate3D2Order( const double ( *coeff )[2][3][32], const int ( *dual )[32],
+                                             const double ( *field_buffer )[4][4], int np, float *out )
+            {
+                double interp_res[32];
+                interpolate3D2Order<dual_x, dual_y, dual_z>( coeff, dual, field_buffer, np, interp_res );
+                for( int ipart=0 ; ipart<np ; ipart++ ) {
+                    out[ipart] = static_cast<float>( interp_res[ipart] );
+                }
+            }
+
+        } // namespace simd
+    } // namespace tools
+} // namespace smilei
+
+#endif
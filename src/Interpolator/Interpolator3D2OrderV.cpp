@@ -7,17 +7,28 @@
 #include "Field3D.h"
 #include "Particles.h"
 #include "LaserEnvelope.h"
+#if defined( SMILEI_SIMD_KERNELS )
+#include "Interpolator3D2OrderSimd.h"
+#endif
 
 using namespace std;
+#if defined( SMILEI_SIMD_KERNELS )
+namespace simd = smilei::tools::simd;
+#endif
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Creator for Interpolator3D2OrderV
 // ---------------------------------------------------------------------------------------------------------------------
-Interpolator3D2OrderV::Interpolator3D2OrderV( Params &params, Patch *patch ) : Interpolator3D2Order( params, patch )
+Interpolator3D2OrderV::Interpolator3D2OrderV( Params &params, Patch *patch, bool mixed_precision ) :
+    Interpolator3D2Order( params, patch ),
+    mixed_precision_( mixed_precision )
 {
     d_inv_[0] = 1.0/params.cell_length[0];
     d_inv_[1] = 1.0/params.cell_length[1];
     d_inv_[2] = 1.0/params.cell_length[2];
+#if defined( SMILEI_SIMD_KERNELS )
+    simd_kernels_ = true;
+#endif
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -40,6 +51,30 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
         return;    //Don't treat empty cells.
     }
 
+    if( mixed_precision_ ) {
+        fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                         smpi->dynamics_Epart_float[ithread].data(), smpi->dynamics_Bpart_float[ithread].data() );
+    } else {
+        fieldsInBuffers( EMfields, particles, smpi, istart, iend, ithread, ipart_ref,
+                         smpi->dynamics_Epart[ithread].data(), smpi->dynamics_Bpart[ithread].data() );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Interpolation of the fields for the particles of one cell. The result is stored in Epart_buffer and Bpart_buffer
+// which may be in single precision (mixed_precision species): the computation itself is always done in double.
+// ---------------------------------------------------------------------------------------------------------------------
+template<typename field_t>
+void Interpolator3D2OrderV::fieldsInBuffers( ElectroMagn * __restrict__ EMfields,
+                                             Particles &particles,
+                                             SmileiMPI * __restrict__ smpi,
+                                             int * __restrict__ istart,
+                                             int * __restrict__ iend,
+                                             int ithread,
+                                             int ipart_ref,
+                                             field_t * __restrict__ Epart_buffer,
+                                             field_t * __restrict__ Bpart_buffer )
+{
     int idxO[3];
     double idx[3];
     //Primal indices are the same for all particles
@@ -59,8 +94,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
 
     const int nparts = smpi->getBufferSize(ithread);
 
-    double * __restrict__ Epart[3];
-    double * __restrict__ Bpart[3];
+    field_t * __restrict__ Epart[3];
+    field_t * __restrict__ Bpart[3];
 
     const double *const __restrict__ position_x = particles.getPtrPosition( 0 );
     const double *const __restrict__ position_y = particles.getPtrPosition( 1 );
@@ -92,8 +127,8 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
         deltaO[2] = &( smpi->dynamics_deltaold[ithread][2*nparts + ivect + istart[0] - ipart_ref] );
 
         for( unsigned int k=0; k<3; k++ ) {
-            Epart[k]= &( smpi->dynamics_Epart[ithread][k*nparts-ipart_ref+ivect+istart[0]] );
-            Bpart[k]= &( smpi->dynamics_Bpart[ithread][k*nparts-ipart_ref+ivect+istart[0]] );
+            Epart[k]= &( Epart_buffer[k*nparts-ipart_ref+ivect+istart[0]] );
+            Bpart[k]= &( Bpart_buffer[k*nparts-ipart_ref+ivect+istart[0]] );
         }
 
         double delta2, delta;
@@ -221,6 +256,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<1, 0, 0>( coeff, dual, field_buffer, np_computed, Epart[0] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
@@ -252,6 +292,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<0, 1, 0>( coeff, dual, field_buffer, np_computed, Epart[1] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
@@ -282,6 +327,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<0, 0, 1>( coeff, dual, field_buffer, np_computed, Epart[2] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
@@ -315,6 +365,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<0, 1, 1>( coeff, dual, field_buffer, np_computed, Bpart[0] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
@@ -347,6 +402,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<1, 0, 1>( coeff, dual, field_buffer, np_computed, Bpart[1] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
@@ -380,6 +440,11 @@ void Interpolator3D2OrderV::fieldsWrapper( ElectroMagn * __restrict__ EMfields,
             }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            simd::interpolate3D2Order<1, 1, 0>( coeff, dual, field_buffer, np_computed, Bpart[2] );
+        } else
+#endif
         #pragma omp simd private(interp_res)
         for ( int ipart=0 ; ipart<np_computed; ipart++ ) {
 
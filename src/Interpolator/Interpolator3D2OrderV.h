@@ -15,7 +15,7 @@ class Interpolator3D2OrderV final : public Interpolator3D2Order
 public:
 
     //! Creator for Interpolator3D2OrderV
-    Interpolator3D2OrderV( Params &, Patch * );
+    Interpolator3D2OrderV( Params &, Patch *, bool mixed_precision = false );
 
     //! Destructor for Interpolator3D2OrderV
     ~Interpolator3D2OrderV() override final {};
@@ -57,8 +57,21 @@ public:
     //! Interpolator specific to the envelope model
     void envelopeAndSusceptibility( ElectroMagn *EMfields, Particles &particles, int ipart, double *Env_A_abs_Loc, double *Env_Chi_Loc, double *Env_E_abs_Loc, double *Env_Ex_abs_Loc ) override final;
 
+#if defined( SMILEI_SIMD_KERNELS )
+    //! Use the explicit-SIMD kernels (default) rather than the `#pragma omp simd` loops,
+    //! switched off by smilei_simd_bench to compare both
+    bool simd_kernels_;
+#endif
+
 private:
 
+    //! Interpolation of E and B for the particles of one cell, written in buffers of type field_t
+    template<typename field_t>
+    void fieldsInBuffers( ElectroMagn *EMfields, Particles &particles, SmileiMPI *smpi, int *istart, int *iend, int ithread, int ipart_ref,
+                          field_t *Epart_buffer, field_t *Bpart_buffer );
+
+    //! Whether the interpolated fields are stored in single precision
+    bool mixed_precision_;
 
 };//END class
 
@@ -41,7 +41,7 @@
 class InterpolatorFactory
 {
 public:
-    static Interpolator *create( Params &params, Patch *patch, bool vectorization )
+    static Interpolator *create( Params &params, Patch *patch, bool vectorization, bool mixed_precision = false )
     {
         
         Interpolator *Interp = NULL;
@@ -126,7 +126,7 @@ public:
             }
             else {
                 if( params.interpolator_ == "momentum-conserving" ) {
-                    Interp = new Interpolator3D2OrderV( params, patch );
+                    Interp = new Interpolator3D2OrderV( params, patch, mixed_precision );
                 }
                 else if ( params.interpolator_ == "wt" ) {
                     Interp = new Interpolator3DWT2OrderV( params, patch );
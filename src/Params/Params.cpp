@@ -769,6 +769,10 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     vectorization_mode = "off";
     has_adaptive_vectorization = false;
     adaptive_vecto_time_selection = nullptr;
+    fused_dynamics = false;
+    fused_chunk_size = 64;
+    full_sort_threshold = 0.3;
+    cell_ordering = "row_major";
 
     if( PyTools::nComponents( "Vectorization" )>0 ) {
         // Extraction of the vectorization mode
@@ -826,6 +830,39 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
                 PyTools::extract_py( "reconfigure_every", "Vectorization" ), "Adaptive vectorization"
             );
         }
+
+        // Fused interpolation, push and projection
+        PyTools::extract( "fused_dynamics", fused_dynamics, "Vectorization" );
+        int chunk_size;
+        PyTools::extract( "fused_chunk_size", chunk_size, "Vectorization" );
+        if( chunk_size < 1 ) {
+            ERROR_NAMELIST( "In block `Vectorization`, parameter `fused_chunk_size` must be strictly positive",  LINK_NAMELIST + std::string("#vectorization") );
+        }
+        fused_chunk_size = chunk_size;
+        if( fused_dynamics && vectorization_mode == "off" ) {
+            WARNING( "In block `Vectorization`, `fused_dynamics` has no effect when `mode` is `off`" );
+            fused_dynamics = false;
+        }
+
+        // Fraction of particles changing cell above which the cell sorting is not incremental
+        PyTools::extract( "full_sort_threshold", full_sort_threshold, "Vectorization" );
+        if( full_sort_threshold < 0. || full_sort_threshold > 1. ) {
+            ERROR_NAMELIST( "In block `Vectorization`, parameter `full_sort_threshold` must be between 0 and 1",  LINK_NAMELIST + std::string("#vectorization") );
+        }
+
+        // Order of the cells of the patches for the cell sorting
+        PyTools::extract( "cell_ordering", cell_ordering, "Vectorization" );
+        if( !( cell_ordering == "row_major" || cell_ordering == "morton" || cell_ordering == "hilbert" ) ) {
+            ERROR_NAMELIST( "In block `Vectorization`, parameter `cell_ordering` must be `row_major`, `morton` or `hilbert`",  LINK_NAMELIST + std::string("#vectorization") );
+        }
+        if( cell_ordering != "row_major" ) {
+            if( vectorization_mode != "on" ) {
+                ERROR_NAMELIST( "In block `Vectorization`, `cell_ordering = \"" << cell_ordering << "\"` requires `mode = \"on\"`",  LINK_NAMELIST + std::string("#vectorization") );
+            }
+            if( !( geometry == "2Dcartesian" || geometry == "3Dcartesian" ) ) {
+                ERROR_NAMELIST( "In block `Vectorization`, `cell_ordering` is only available in `2Dcartesian` and `3Dcartesian` geometries",  LINK_NAMELIST + std::string("#vectorization") );
+            }
+        }
     }
 
     PyTools::extract( "gpu_computing", gpu_computing, "Main" );
@@ -847,6 +884,110 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
 #endif
     }
 
+    PyTools::extract( "persistent_communications", persistent_communications, "Main" );
+    PyTools::extract( "aggregate_communications", aggregate_communications, "Main" );
+    if( aggregate_communications && gpu_computing ) {
+        ERROR_NAMELIST( "`Main.aggregate_communications` is not available on GPU",
+                        LINK_NAMELIST + std::string("#main-variables") );
+    }
+    PyTools::extract( "shared_memory_communications", shared_memory_communications, "Main" );
+    if( shared_memory_communications && !aggregate_communications ) {
+        ERROR_NAMELIST( "`Main.shared_memory_communications` requires `Main.aggregate_communications`",
+                        LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    PyTools::extract( "float_sums", float_sums, "Main" );
+    PyTools::extract( "float_sums_tolerance", float_sums_tolerance, "Main" );
+    if( float_sums ) {
+        if( gpu_computing || geometry == "AMcylindrical" ) {
+            ERROR_NAMELIST( "`Main.float_sums` is not available on GPU nor in AMcylindrical geometry",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( float_sums_tolerance < 0. ) {
+            ERROR_NAMELIST( "`Main.float_sums_tolerance` must be positive",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    PyTools::extract( "pipelined_particle_exchange", pipelined_particle_exchange, "Main" );
+    if( pipelined_particle_exchange ) {
+#ifdef _NO_MPI_TM
+        ERROR_NAMELIST( "`Main.pipelined_particle_exchange` requires MPI_THREAD_MULTIPLE",
+                        LINK_NAMELIST + std::string("#main-variables") );
+#endif
+        if( gpu_computing || Laser_Envelope_model ) {
+            ERROR_NAMELIST( "`Main.pipelined_particle_exchange` is not available on GPU nor with a laser envelope",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    PyTools::extract( "packed_particle_exchange", packed_particle_exchange, "Main" );
+    if( packed_particle_exchange && gpu_computing ) {
+        ERROR_NAMELIST( "`Main.packed_particle_exchange` is not available on GPU",
+                        LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    PyTools::extract( "direct_particle_exchange", direct_particle_exchange, "Main" );
+    if( direct_particle_exchange ) {
+        if( geometry != "2Dcartesian" && geometry != "3Dcartesian" ) {
+            ERROR_NAMELIST( "`Main.direct_particle_exchange` is only available in 2Dcartesian and 3Dcartesian geometries",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( gpu_computing ) {
+            ERROR_NAMELIST( "`Main.direct_particle_exchange` is not available on GPU",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    // Cache blocking of the Maxwell solver
+    PyTools::extract( "maxwell_tile_size", maxwell_tile_size, "Main" );
+    PyTools::extract( "maxwell_temporal_blocking", maxwell_temporal_blocking, "Main" );
+    if( maxwell_tile_size > 0 || maxwell_temporal_blocking ) {
+        if( geometry != "3Dcartesian" || maxwell_sol != "Yee" || is_pxr || gpu_computing ) {
+            ERROR_NAMELIST( "`Main.maxwell_tile_size` and `Main.maxwell_temporal_blocking` are only available with the `Yee` solver in `3Dcartesian` geometry, on CPU",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( maxwell_temporal_blocking && maxwell_tile_size == 0 ) {
+            ERROR_NAMELIST( "`Main.maxwell_temporal_blocking` requires `Main.maxwell_tile_size` > 0",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        // The Friedman solver of Maxwell-Ampere has no fused Maxwell-Faraday update
+        if( maxwell_temporal_blocking && Friedman_filter ) {
+            ERROR_NAMELIST( "`Main.maxwell_temporal_blocking` is not compatible with the Friedman filter",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    // Overlap of the exchange of B with the Maxwell-Faraday solver
+    PyTools::extract( "maxwell_overlap_communications", maxwell_overlap_communications, "Main" );
+    if( maxwell_overlap_communications ) {
+        if( ( geometry != "2Dcartesian" && geometry != "3Dcartesian" ) || maxwell_sol != "Yee" || is_pxr || gpu_computing ) {
+            ERROR_NAMELIST( "`Main.maxwell_overlap_communications` is only available with the `Yee` solver in `2Dcartesian` and `3Dcartesian` geometries, on CPU",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( maxwell_temporal_blocking || full_B_exchange ) {
+            ERROR_NAMELIST( "`Main.maxwell_overlap_communications` is not compatible with `Main.maxwell_temporal_blocking` nor with `buneman` boundary conditions",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    // Field updates chained per patch
+    PyTools::extract( "fused_field_loops", fused_field_loops, "Main" );
+    if( fused_field_loops ) {
+        if( is_spectral || gpu_computing ) {
+            ERROR_NAMELIST( "`Main.fused_field_loops` is only available with finite-difference solvers, on CPU",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( use_pml ) {
+            ERROR_NAMELIST( "`Main.fused_field_loops` is not compatible with `PML` boundary conditions",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( PyTools::nComponents( "MultipleDecomposition" ) > 0 ) {
+            ERROR_NAMELIST( "`Main.fused_field_loops` is not compatible with `MultipleDecomposition`",
+                            LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
     // In case of collisions, ensure particle sort per cell
     if( PyTools::nComponents( "Collisions" ) > 0 ) {
 
@@ -1348,6 +1489,27 @@ void Params::print_init()
     if( full_B_exchange ) {
         MESSAGE( 1, "All components of B are exchanged at synchronization" );
     }
+    if( persistent_communications ) {
+        MESSAGE( 1, "Field exchanges through persistent MPI requests" );
+    }
+    if( aggregate_communications ) {
+        MESSAGE( 1, "Field exchanges aggregated in one message per neighbor MPI process" );
+    }
+    if( shared_memory_communications ) {
+        MESSAGE( 1, "Field exchanges between MPI processes of the same node through shared memory" );
+    }
+    if( float_sums ) {
+        MESSAGE( 1, "Sums of the densities sent in single precision (relative tolerance " << float_sums_tolerance << ")" );
+    }
+    if( pipelined_particle_exchange ) {
+        MESSAGE( 1, "Particle exchanges started during the dynamics of the patches" );
+    }
+    if( packed_particle_exchange ) {
+        MESSAGE( 1, "Particles exchanged between MPI processes in a packed format (float positions)" );
+    }
+    if( direct_particle_exchange ) {
+        MESSAGE( 1, "Particles exchanged directly with all the neighbor patches, corners included" );
+    }
 
     TITLE( "Geometry: " << geometry );
     MESSAGE( 1, "Interpolation order : " <<  interpolation_order );
@@ -1355,6 +1517,16 @@ void Params::print_init()
         MESSAGE(1, "B-TIS3 interpolation scheme activated")
     }
     MESSAGE( 1, "Maxwell solver : " <<  maxwell_sol );
+    if( maxwell_tile_size > 0 ) {
+        MESSAGE( 1, "Maxwell solver tiles : " << maxwell_tile_size << " cells in y"
+                 << ( maxwell_temporal_blocking ? ", with temporal blocking" : "" ) );
+    }
+    if( maxwell_overlap_communications ) {
+        MESSAGE( 1, "Exchange of B overlapped with the Maxwell-Faraday solver" );
+    }
+    if( fused_field_loops ) {
+        MESSAGE( 1, "Loops of the field updates fused over the patches, without barriers in between" );
+    }
     MESSAGE( 1, "simulation duration = " << simulation_time <<",   total number of iterations = " << n_time);
     MESSAGE( 1, "timestep = " << timestep << " = " << timestep/dtCFL << " x CFL,   time resolution = " << res_time);
 
@@ -1456,6 +1628,23 @@ void Params::print_init()
         MESSAGE( 1, "Default mode: " << adaptive_default_mode );
         MESSAGE( 1, "Time selection: " << adaptive_vecto_time_selection->info() );
     }
+    if( fused_dynamics ) {
+        MESSAGE( 1, "Fused dynamics: clusters of at least " << fused_chunk_size << " particles" );
+    }
+    if( cell_sorting_ ) {
+        // Only the vectorized species sort their particles incrementally
+        const bool vectorized_sort = !gpu_computing
+                                     && ( vectorization_mode == "on"
+                                          || ( has_adaptive_vectorization
+                                               && !( adaptive_default_mode == "off" && adaptive_vecto_time_selection->isEmpty() ) ) );
+        if( vectorized_sort && full_sort_threshold > 0. ) {
+            MESSAGE( 1, "Incremental cell sorting" << ( vectorization_mode == "on" ? "" : " of the vectorized species" )
+                     << ", full count sort threshold = " << full_sort_threshold );
+        } else if( vectorized_sort ) {
+            MESSAGE( 1, "Cell sorting by full count sort" << ( vectorization_mode == "on" ? "" : " for the vectorized species" ) );
+        }
+        MESSAGE( 1, "Order of the cells in the patches: " << cell_ordering );
+    }
 
 }
 
@@ -178,6 +178,41 @@ public:
     //! Maxwell Solver (default='Yee')
     std::string maxwell_sol;
 
+    //! Size (in cells, in the y direction) of the tiles of the Maxwell solver (0 = no tiling)
+    unsigned int maxwell_tile_size;
+
+    //! Is the Faraday update of each tile done in the same sweep as its Ampere update
+    bool maxwell_temporal_blocking;
+
+    //! Is B updated on the layers sent to the neighbors first, then on the interior while the messages are in flight
+    bool maxwell_overlap_communications;
+
+    //! Are the loops of the field updates over the patches fused, without barriers in between
+    bool fused_field_loops;
+
+    //! Are the field exchanges done through persistent MPI requests
+    bool persistent_communications;
+
+    //! Are the field exchanges aggregated in one message per neighbor MPI process
+    bool aggregate_communications;
+
+    //! Are the aggregated field exchanges between MPI processes of the same node done in shared memory
+    bool shared_memory_communications;
+
+    //! Are the sums of the total densities between MPI processes sent in single precision
+    bool float_sums;
+    //! Maximum relative rounding error of a sum message sent in single precision (sent in double otherwise)
+    double float_sums_tolerance;
+
+    //! Are the particles leaving a patch sent along x as soon as its dynamics is done
+    bool pipelined_particle_exchange;
+
+    //! Are the particles exchanged between MPI processes packed in a single buffer, with float positions
+    bool packed_particle_exchange;
+
+    //! Are the particles sent directly to all the neighbor patches (corners included) in a single exchange phase
+    bool direct_particle_exchange;
+
     //! Current spatial filter: number of binomial passes
     std::vector<unsigned int> currentFilter_passes;
     std::string currentFilter_model;
@@ -294,6 +329,14 @@ public:
     std::string vectorization_mode;
     //! Initial state of the patches in adaptive mode
     std::string adaptive_default_mode;
+    //! Interpolation, push and projection processed together per cluster of cells (vectorized species)
+    bool fused_dynamics;
+    //! Minimum number of particles in a cluster of cells processed by the fused dynamics
+    unsigned int fused_chunk_size;
+    //! Fraction of the particles changing cell above which the cell sorting is a full count sort
+    double full_sort_threshold;
+    //! Order of the cells of a patch for the cell sorting: row_major, morton or hilbert
+    std::string cell_ordering;
 
     //! Tells whether there is a moving window
     bool hasWindow;
@@ -313,6 +313,25 @@ void Particles::shrinkToFit(const bool compute_cell_keys)
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Exchange the content of the properties with those of another Particles object, without copy
+//! Both objects must have the same list of properties. cell_keys are not exchanged.
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::swapProperties( Particles &other )
+{
+    for( unsigned int iprop=0 ; iprop<double_prop_.size() ; iprop++ ) {
+        double_prop_[iprop]->swap( *other.double_prop_[iprop] );
+    }
+
+    for( unsigned int iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        short_prop_[iprop]->swap( *other.short_prop_[iprop] );
+    }
+
+    for( unsigned int iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        uint64_prop_[iprop]->swap( *other.uint64_prop_[iprop] );
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! Reset of Particles vectors
 //! params [in] compute_cell_keys: if true, cell_keys is affected (default is false)
@@ -783,7 +802,7 @@ void Particles::swapParticle4( unsigned int part1, unsigned int part2, unsigned
 }
 
 
-void Particles::swapParticles( std::vector<unsigned int> parts )
+void Particles::swapParticles( const std::vector<unsigned int> &parts )
 {
     // parts[0] ==> parts[1] ==> parts[2] ==> parts[parts.size()-1] ==> parts[0]
 
@@ -795,7 +814,7 @@ void Particles::swapParticles( std::vector<unsigned int> parts )
 }
 
 
-void Particles::translateParticles( std::vector<unsigned int> parts )
+void Particles::translateParticles( const std::vector<unsigned int> &parts )
 {
     // parts[0] ==> parts[1] ==> parts[2] ==> parts[parts.size()-1]
 
@@ -1348,6 +1367,98 @@ void Particles::copyLeavingParticlesToBuffers( const vector<bool> copy, const ve
 #endif
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Size in bytes of the packed particles : positions of the first particle, then the properties, the largest types first
+// ---------------------------------------------------------------------------------------------------------------------
+std::size_t Particles::packedSize() const
+{
+    const std::size_t n = size();
+    const std::size_t nDim = dimension();
+    if( n == 0 ) {
+        return 0;
+    }
+    return nDim*sizeof( double )
+           + ( double_prop_.size()-nDim )*n*sizeof( double )
+           + uint64_prop_.size()*n*sizeof( uint64_t )
+           + nDim*n*sizeof( float )
+           + short_prop_.size()*n*sizeof( short );
+}
+
+void Particles::pack( std::vector<char> &buffer ) const
+{
+    const std::size_t n = size();
+    const std::size_t nDim = dimension();
+    buffer.resize( packedSize() );
+    if( n == 0 ) {
+        return;
+    }
+    char *p = buffer.data();
+
+    // Reference positions
+    for( std::size_t iDim=0 ; iDim<nDim ; iDim++ ) {
+        std::memcpy( p, &Position[iDim][0], sizeof( double ) );
+        p += sizeof( double );
+    }
+    // The positions are the first nDim double properties
+    for( std::size_t iprop=nDim ; iprop<double_prop_.size() ; iprop++ ) {
+        std::memcpy( p, double_prop_[iprop]->data(), n*sizeof( double ) );
+        p += n*sizeof( double );
+    }
+    for( std::size_t iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        std::memcpy( p, uint64_prop_[iprop]->data(), n*sizeof( uint64_t ) );
+        p += n*sizeof( uint64_t );
+    }
+    for( std::size_t iDim=0 ; iDim<nDim ; iDim++ ) {
+        float *const offset = reinterpret_cast<float *>( p );
+        const double *const position = Position[iDim].data();
+        const double reference = position[0];
+        for( std::size_t ipart=0 ; ipart<n ; ipart++ ) {
+            offset[ipart] = static_cast<float>( position[ipart] - reference );
+        }
+        p += n*sizeof( float );
+    }
+    for( std::size_t iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        std::memcpy( p, short_prop_[iprop]->data(), n*sizeof( short ) );
+        p += n*sizeof( short );
+    }
+}
+
+void Particles::unpack( const std::vector<char> &buffer )
+{
+    const std::size_t n = size();
+    const std::size_t nDim = dimension();
+    if( n == 0 ) {
+        return;
+    }
+    const char *p = buffer.data();
+
+    double reference[3];
+    for( std::size_t iDim=0 ; iDim<nDim ; iDim++ ) {
+        std::memcpy( &reference[iDim], p, sizeof( double ) );
+        p += sizeof( double );
+    }
+    for( std::size_t iprop=nDim ; iprop<double_prop_.size() ; iprop++ ) {
+        std::memcpy( double_prop_[iprop]->data(), p, n*sizeof( double ) );
+        p += n*sizeof( double );
+    }
+    for( std::size_t iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        std::memcpy( uint64_prop_[iprop]->data(), p, n*sizeof( uint64_t ) );
+        p += n*sizeof( uint64_t );
+    }
+    for( std::size_t iDim=0 ; iDim<nDim ; iDim++ ) {
+        const float *const offset = reinterpret_cast<const float *>( p );
+        double *const position = Position[iDim].data();
+        for( std::size_t ipart=0 ; ipart<n ; ipart++ ) {
+            position[ipart] = reference[iDim] + static_cast<double>( offset[ipart] );
+        }
+        p += n*sizeof( float );
+    }
+    for( std::size_t iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        std::memcpy( short_prop_[iprop]->data(), p, n*sizeof( short ) );
+        p += n*sizeof( short );
+    }
+}
+
 void Particles::copyLeavingParticlesToBuffer( Particles* )
 {
     ERROR( "Device only feature, should not have come here!" );
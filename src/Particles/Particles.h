@@ -87,6 +87,9 @@ public:
     //! params [in] compute_cell_keys: if true, cell_keys is affected (default is false)
     void clear(const bool compute_cell_keys = false);
 
+    //! Exchange the content of the properties (not the cell_keys) with another Particles object
+    void swapProperties( Particles &other );
+
     //! Get number of particles
     inline unsigned int numberOfParticles() const
     {
@@ -166,8 +169,8 @@ public:
 
     //! Exchange particles part1 & part2 memory location
     void swapParticle( unsigned int part1, unsigned int part2 );
-    void swapParticles( std::vector<unsigned int> parts );
-    void translateParticles( std::vector<unsigned int> parts );
+    void swapParticles( const std::vector<unsigned int> &parts );
+    void translateParticles( const std::vector<unsigned int> &parts );
     void swapParticle3( unsigned int part1, unsigned int part2, unsigned int part3 );
     void swapParticle4( unsigned int part1, unsigned int part2, unsigned int part3, unsigned int part4 );
 
@@ -486,6 +489,15 @@ public:
     void copyLeavingParticlesToBuffers( const std::vector<bool> copy, const std::vector<Particles*> buffer );
     virtual void copyLeavingParticlesToBuffer( Particles* buffer );
 
+    // -----------------------------------------------------------------------------
+    //! Packed format of the particle exchanges (see Main.packed_particle_exchange)
+    //! All the properties in a single buffer, positions as float offsets from those of the first particle
+    // -----------------------------------------------------------------------------
+    std::size_t packedSize() const;
+    void pack( std::vector<char> &buffer ) const;
+    //! The particles must already have the size of the packed ones
+    void unpack( const std::vector<char> &buffer );
+
     // -----------------------------------------------------------------------------
     //! Erase particles leaving the patch object on device
     // -----------------------------------------------------------------------------
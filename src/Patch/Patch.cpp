@@ -488,6 +488,8 @@ void Patch::updateMPIenv( SmileiMPI *smpi )
 //    vector<int> npatchs(2,4);   // NDOMAIN TOTAL
 //    vector<int> gCoord(2,0);
     MPI_me_ = smpi->smilei_rk;
+    // The MPI ranks of the direct neighbors are computed again before the next exchange
+    direct_neighbor_hindex_ = -1;
 
     for( int iDim = 0 ; iDim < nDim_fields_ ; iDim++ )
         for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
@@ -667,7 +669,7 @@ void Patch::prepareParticles( SmileiMPI *smpi, int ispec, Params &params, int iD
 } // END prepareParticles(... iDim)
 
 
-void Patch::exchParticles( SmileiMPI *smpi, int ispec, Params &, int iDim, VectorPatch *vecPatch )
+void Patch::exchParticles( SmileiMPI *smpi, int ispec, Params &params, int iDim, VectorPatch *vecPatch )
 {
     SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
     
@@ -678,18 +680,30 @@ void Patch::exchParticles( SmileiMPI *smpi, int ispec, Params &, int iDim, Vecto
         if( partSend.size() != 0 && is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             int local_hindex = hindex - vecPatch->refHindex_;
             int tag = buildtag( local_hindex, iDim+1, iNeighbor+3 );
-            vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor] = smpi->createMPIparticles( &partSend );
-            MPI_Isend( &partSend.position( 0, 0 ), 1, vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &( buffer.srequest[iDim][iNeighbor] ) );
+            if( params.packed_particle_exchange ) {
+                std::vector<char> &packed = buffer.packedSend[iDim][iNeighbor];
+                partSend.pack( packed );
+                MPI_Isend( packed.data(), packed.size(), MPI_BYTE, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &( buffer.srequest[iDim][iNeighbor] ) );
+            } else {
+                vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor] = smpi->createMPIparticles( &partSend );
+                MPI_Isend( &partSend.position( 0, 0 ), 1, vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor], MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &( buffer.srequest[iDim][iNeighbor] ) );
+            }
         }
         
         // Receive
         int iOppositeNeighbor = ( iNeighbor+1 )%2;
         Particles &partRecv = *buffer.partRecv[iDim][iOppositeNeighbor];
         if( partRecv.size() != 0 && is_a_MPI_neighbor( iDim, iOppositeNeighbor ) ) {
-            vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor] = smpi->createMPIparticles( &partRecv );
             int local_hindex = neighbor_[iDim][iOppositeNeighbor] - smpi->patch_refHindexes[ MPI_neighbor_[iDim][iOppositeNeighbor] ];
             int tag = buildtag( local_hindex, iDim+1, iNeighbor+3 );
-            MPI_Irecv( &partRecv.position( 0, 0 ), 1, vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor], MPI_neighbor_[iDim][iOppositeNeighbor], tag, MPI_COMM_WORLD, &buffer.rrequest[iDim][iOppositeNeighbor] );
+            if( params.packed_particle_exchange ) {
+                std::vector<char> &packed = buffer.packedRecv[iDim][iOppositeNeighbor];
+                packed.resize( partRecv.packedSize() );
+                MPI_Irecv( packed.data(), packed.size(), MPI_BYTE, MPI_neighbor_[iDim][iOppositeNeighbor], tag, MPI_COMM_WORLD, &buffer.rrequest[iDim][iOppositeNeighbor] );
+            } else {
+                vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor] = smpi->createMPIparticles( &partRecv );
+                MPI_Irecv( &partRecv.position( 0, 0 ), 1, vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor], MPI_neighbor_[iDim][iOppositeNeighbor], tag, MPI_COMM_WORLD, &buffer.rrequest[iDim][iOppositeNeighbor] );
+            }
         }
         
     }
@@ -700,7 +714,7 @@ void Patch::exchParticles( SmileiMPI *smpi, int ispec, Params &, int iDim, Vecto
 // ---------------------------------------------------------------------------------------------------------------------
 // For direction iDim, wait receive of particles
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch::waitExchParticles( int ispec, int iDim )
+void Patch::waitExchParticles( int ispec, int iDim, Params &params )
 {
     SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
     
@@ -715,11 +729,17 @@ void Patch::waitExchParticles( int ispec, int iDim )
         
         if( partSend.size() != 0 &&  is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             MPI_Wait( &buffer.srequest[iDim][iNeighbor], &sstat[iNeighbor] );
-            MPI_Type_free( &vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor] );
+            if( !params.packed_particle_exchange ) {
+                MPI_Type_free( &vecSpecies[ispec]->typePartSend[( iDim*2 )+iNeighbor] );
+            }
         }
         if( partRecv.size() != 0 && is_a_MPI_neighbor( iDim, iOppositeNeighbor ) ) {
             MPI_Wait( &buffer.rrequest[iDim][iOppositeNeighbor], &rstat[iOppositeNeighbor] );
-            MPI_Type_free( &vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor] );
+            if( params.packed_particle_exchange ) {
+                partRecv.unpack( buffer.packedRecv[iDim][iOppositeNeighbor] );
+            } else {
+                MPI_Type_free( &vecSpecies[ispec]->typePartRecv[( iDim*2 )+iNeighbor] );
+            }
         }
     }
 }
@@ -800,6 +820,283 @@ void Patch::cornersParticles( int ispec, Params &params, int iDim )
     } //loop i Neighbor
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Direct exchange of the particles with all the neighbors, corners included
+//   The particles crossing a corner are sent directly to the diagonal neighbor instead of being forwarded
+//   dimension by dimension (see cornersParticles) : a single exchange phase is needed
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::updateDirectNeighbors( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition )
+{
+    // The neighbors only change when the patch moves (moving window) or when the patches are exchanged (load balancing)
+    if( direct_neighbor_hindex_ == ( int )hindex ) {
+        return;
+    }
+    
+    int nNeighbors = 1;
+    for( int iDim = 0 ; iDim < nDim_fields_ ; iDim++ ) {
+        nNeighbors *= 3;
+    }
+    direct_neighbor_    .assign( nNeighbors, MPI_PROC_NULL );
+    MPI_direct_neighbor_.assign( nNeighbors, MPI_PROC_NULL );
+    
+    std::vector<int> xcall( nDim_fields_ );
+    for( int k = 0 ; k < nNeighbors ; k++ ) {
+        int stride = 1;
+        for( int iDim = 0 ; iDim < nDim_fields_ ; iDim++ ) {
+            xcall[iDim] = Pcoordinates[iDim] + ( k/stride )%3 - 1;
+            if( params.EM_BCs[iDim][0]=="periodic" ) {
+                if( xcall[iDim] < 0 ) {
+                    xcall[iDim] += domain_decomposition->ndomain_[iDim];
+                } else if( xcall[iDim] >= ( int )domain_decomposition->ndomain_[iDim] ) {
+                    xcall[iDim] -= domain_decomposition->ndomain_[iDim];
+                }
+            }
+            stride *= 3;
+        }
+        direct_neighbor_[k] = domain_decomposition->getDomainId( xcall );
+        MPI_direct_neighbor_[k] = smpi->hrank( direct_neighbor_[k] );
+    }
+    
+    direct_neighbor_hindex_ = hindex;
+}
+
+
+void Patch::copyExchParticlesToDirectBuffers( int ispec, Params &params )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    Particles &part = *vecSpecies[ispec]->particles;
+    
+    cleanMPIBuffers( ispec, params );
+    for( size_t k = 0; k < buffer.cornerSend.size(); k++ ) {
+        if( buffer.cornerSend[k] ) {
+            buffer.cornerSend[k]->clear();
+            buffer.cornerRecv[k]->clear();
+        }
+    }
+    
+    for( size_t ipart = 0; ipart < part.size(); ipart++ ) {
+        if( part.cell_keys[ipart] < -1 ) {
+            // The cell key gives the face crossed (see copyLeavingParticlesToBuffers),
+            // the positions tell if the particle also leaves through other faces
+            int direction = -part.cell_keys[ipart] - 2;
+            int k = 0, stride = 1;
+            for( int iDim = 0; iDim < nDim_fields_; iDim++ ) {
+                if( iDim == direction/2 ) {
+                    k += 2*( direction%2 ) * stride;
+                } else if( part.position( iDim, ipart ) >= max_local_[iDim] ) {
+                    k += 2 * stride;
+                } else if( part.position( iDim, ipart ) >= min_local_[iDim] ) {
+                    k += stride;
+                }
+                stride *= 3;
+            }
+            if( direct_neighbor_[k] != MPI_PROC_NULL ) {
+                part.copyParticle( ipart, *buffer.directSend( k ) );
+            }
+        }
+    }
+    
+} // copyExchParticlesToDirectBuffers
+
+
+void Patch::exchNbrOfDirectParticles( SmileiMPI *smpi, int ispec, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int nNeighbors = direct_neighbor_.size();
+    
+    for( int k = 0 ; k < nNeighbors ; k++ ) {
+        if( direct_neighbor_[k] == MPI_PROC_NULL || k == nNeighbors/2 ) {
+            continue;
+        }
+        int kOpposite = nNeighbors-1-k;
+        
+        buffer.directSendSize[k] = buffer.directSend( k )->size();
+        
+        if( is_a_direct_MPI_neighbor( k ) ) {
+            // Send number of particles to neighbor k
+            int local_hindex = hindex - vecPatch->refHindex_;
+            int tag = buildtag( local_hindex, 5, k+10 );
+            MPI_Isend( &buffer.directSendSize[k], 1, MPI_INT, MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directSrequest[k] );
+            // Receive number of particles from neighbor k, which sends them towards kOpposite
+            local_hindex = direct_neighbor_[k] - smpi->patch_refHindexes[ MPI_direct_neighbor_[k] ];
+            tag = buildtag( local_hindex, 5, kOpposite+10 );
+            MPI_Irecv( &buffer.directRecvSize[k], 1, MPI_INT, MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directRrequest[k] );
+        } else {
+            // If the destination is in the same MPI, directly set the number at destination
+            int destination_hindex = direct_neighbor_[k] - vecPatch->refHindex_;
+            SpeciesMPIbuffers &destination_buffer = ( *vecPatch )( destination_hindex )->vecSpecies[ispec]->MPI_buffer_;
+            destination_buffer.directRecvSize[kOpposite] = buffer.directSendSize[k];
+        }
+    }
+    
+} // exchNbrOfDirectParticles
+
+
+void Patch::endNbrOfDirectParticles( int ispec )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    
+    for( int k = 0 ; k < ( int )direct_neighbor_.size() ; k++ ) {
+        if( is_a_direct_MPI_neighbor( k ) ) {
+            MPI_Wait( &buffer.directSrequest[k], MPI_STATUS_IGNORE );
+            MPI_Wait( &buffer.directRrequest[k], MPI_STATUS_IGNORE );
+        }
+    }
+    
+} // endNbrOfDirectParticles
+
+
+void Patch::prepareDirectParticles( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int nNeighbors = direct_neighbor_.size();
+    
+    for( int k = 0 ; k < nNeighbors ; k++ ) {
+        if( direct_neighbor_[k] == MPI_PROC_NULL || k == nNeighbors/2 ) {
+            continue;
+        }
+        
+        // Enabled periodicity, along all the dimensions crossed
+        Particles &partSend = *buffer.directSend( k );
+        if( partSend.size() > 0 ) {
+            int stride = 1;
+            for( int iDim = 0; iDim < nDim_fields_; iDim++ ) {
+                int offset = ( k/stride )%3 - 1;
+                stride *= 3;
+                if( smpi->periods_[iDim]!=1 ) {
+                    continue;
+                }
+                double x_max = params.cell_length[iDim]*( params.global_size_[iDim] );
+                if( offset == -1 && Pcoordinates[iDim] == 0 ) {
+                    for( size_t iPart=0; iPart < partSend.size(); iPart++ ) {
+                        if( partSend.position( iDim, iPart ) < 0. ) {
+                            partSend.position( iDim, iPart ) += x_max;
+                        }
+                    }
+                }
+                if( offset == 1 && Pcoordinates[iDim] == params.number_of_patches[iDim]-1 ) {
+                    for( size_t iPart=0; iPart < partSend.size(); iPart++ ) {
+                        if( partSend.position( iDim, iPart ) >= x_max ) {
+                            partSend.position( iDim, iPart ) -= x_max;
+                        }
+                    }
+                }
+            }
+        }
+        
+        // Initialize receive buffer with the appropriate size
+        if( is_a_direct_MPI_neighbor( k ) ) {
+            if( buffer.directRecvSize[k]!=0 ) {
+                buffer.directRecv( k )->initialize( buffer.directRecvSize[k], *vecSpecies[ispec]->particles );
+            }
+        // Swap particles to other patch directly if it belongs to the same MPI
+        } else {
+            SpeciesMPIbuffers &neighbor_buffer = ( *vecPatch )( direct_neighbor_[k] - vecPatch->refHindex_ )->vecSpecies[ispec]->MPI_buffer_;
+            swap( buffer.directSend( k ), neighbor_buffer.directRecv( nNeighbors-1-k ) );
+        }
+    }
+    
+} // prepareDirectParticles
+
+
+void Patch::exchDirectParticles( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int nNeighbors = direct_neighbor_.size();
+    
+    for( int k = 0 ; k < nNeighbors ; k++ ) {
+        if( ! is_a_direct_MPI_neighbor( k ) ) {
+            continue;
+        }
+        
+        // Send
+        Particles &partSend = *buffer.directSend( k );
+        if( partSend.size() != 0 ) {
+            int local_hindex = hindex - vecPatch->refHindex_;
+            int tag = buildtag( local_hindex, 5, k+10 );
+            if( params.packed_particle_exchange ) {
+                std::vector<char> &packed = buffer.directPackedSend[k];
+                partSend.pack( packed );
+                MPI_Isend( packed.data(), packed.size(), MPI_BYTE, MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directSrequest[k] );
+            } else {
+                buffer.directTypeSend[k] = smpi->createMPIparticles( &partSend );
+                MPI_Isend( &partSend.position( 0, 0 ), 1, buffer.directTypeSend[k], MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directSrequest[k] );
+            }
+        }
+        
+        // Receive
+        Particles &partRecv = *buffer.directRecv( k );
+        if( partRecv.size() != 0 ) {
+            int local_hindex = direct_neighbor_[k] - smpi->patch_refHindexes[ MPI_direct_neighbor_[k] ];
+            int tag = buildtag( local_hindex, 5, nNeighbors-1-k+10 );
+            if( params.packed_particle_exchange ) {
+                std::vector<char> &packed = buffer.directPackedRecv[k];
+                packed.resize( partRecv.packedSize() );
+                MPI_Irecv( packed.data(), packed.size(), MPI_BYTE, MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directRrequest[k] );
+            } else {
+                buffer.directTypeRecv[k] = smpi->createMPIparticles( &partRecv );
+                MPI_Irecv( &partRecv.position( 0, 0 ), 1, buffer.directTypeRecv[k], MPI_direct_neighbor_[k], tag, MPI_COMM_WORLD, &buffer.directRrequest[k] );
+            }
+        }
+    }
+    
+} // exchDirectParticles
+
+
+void Patch::waitExchDirectParticles( int ispec, Params &params )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    
+    for( int k = 0 ; k < ( int )direct_neighbor_.size() ; k++ ) {
+        if( ! is_a_direct_MPI_neighbor( k ) ) {
+            continue;
+        }
+        if( buffer.directSend( k )->size() != 0 ) {
+            MPI_Wait( &buffer.directSrequest[k], MPI_STATUS_IGNORE );
+            if( !params.packed_particle_exchange ) {
+                MPI_Type_free( &buffer.directTypeSend[k] );
+            }
+        }
+        Particles &partRecv = *buffer.directRecv( k );
+        if( partRecv.size() != 0 ) {
+            MPI_Wait( &buffer.directRrequest[k], MPI_STATUS_IGNORE );
+            if( params.packed_particle_exchange ) {
+                partRecv.unpack( buffer.directPackedRecv[k] );
+            } else {
+                MPI_Type_free( &buffer.directTypeRecv[k] );
+            }
+        }
+    }
+    
+} // waitExchDirectParticles
+
+
+void Patch::importCornerParticles( int ispec )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    
+    for( int k = 0 ; k < ( int )buffer.cornerRecv.size() ; k++ ) {
+        Particles *partRecv = buffer.cornerRecv[k];
+        if( !partRecv || partRecv->size() == 0 ) {
+            continue;
+        }
+        // Along the last dimension crossed, the sorting finds the bin of each particle from its position
+        int iDim = nDim_fields_-1, stride = 1;
+        for( int i = 0; i < iDim; i++ ) {
+            stride *= 3;
+        }
+        while( ( k/stride )%3 == 1 ) {
+            iDim--;
+            stride /= 3;
+        }
+        Particles &partFace = *buffer.partRecv[iDim][( k/stride )%3 / 2];
+        partRecv->copyParticles( 0, partRecv->size(), partFace, partFace.size() );
+        partRecv->clear();
+    }
+    
+} // importCornerParticles
+
+
 //! Import particles exchanged with surrounding patches/mpi and sort at the same time
 void Patch::importAndSortParticles( int ispec, Params &params )
 {
@@ -922,13 +1219,11 @@ void Patch::initExchange( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
             if (devPtr) {
                 double* sendField = smilei::tools::gpu::HostDeviceMemoryManagement::GetDevicePointer( field->sendFields_[iDim*2+iNeighbor]->data_ );
                 // Assumes a GPU compatible MPI implementation
-                MPI_Isend( sendField, field->sendFields_[iDim*2+iNeighbor]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+                field->MPIbuff.isend( sendField, field->sendFields_[iDim*2+iNeighbor]->size(),
+                                      MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
             } else {
-                MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+                field->MPIbuff.isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->size(),
+                                      MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
             }
         } // END of Send
 
@@ -937,13 +1232,11 @@ void Patch::initExchange( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
             if (devPtr) {
                 double* recvField = smilei::tools::gpu::HostDeviceMemoryManagement::GetDevicePointer( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_ );
                 // Assumes a GPU compatible MPI implementation
-                MPI_Irecv( recvField, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+                field->MPIbuff.irecv( recvField, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
+                                      MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
             } else {
-                MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+                field->MPIbuff.irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
+                                      MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
             }
         } // END of Recv
     } // END for iNeighbor
@@ -973,16 +1266,14 @@ void Patch::initExchangeComplex( Field *field, int iDim, SmileiMPI *smpi )
 
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             int tag = field->MPIbuff.send_tags_[iDim][iNeighbor];
-            MPI_Isend( static_cast<cField *>(field->sendFields_[iDim*2+iNeighbor])->cdata_, 2*field->sendFields_[iDim*2+iNeighbor]->number_of_points_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            field->MPIbuff.isend( reinterpret_cast<double *>( static_cast<cField *>(field->sendFields_[iDim*2+iNeighbor])->cdata_ ), 2*field->sendFields_[iDim*2+iNeighbor]->number_of_points_,
+                                  MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
         } // END of Send
 
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tag = field->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( static_cast<cField *>(field->recvFields_[iDim*2+(iNeighbor+1)%2])->cdata_, 2*field->recvFields_[iDim*2+(iNeighbor+1)%2]->number_of_points_,
-                       MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            field->MPIbuff.irecv( reinterpret_cast<double *>( static_cast<cField *>(field->recvFields_[iDim*2+(iNeighbor+1)%2])->cdata_ ), 2*field->recvFields_[iDim*2+(iNeighbor+1)%2]->number_of_points_,
+                                  MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
         } // END of Recv
 
     } // END for iNeighbor
@@ -1032,6 +1323,8 @@ void Patch::initSumField( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
         }
 
         field->MPIbuff.defineTags( this, smpi, tagp );
+        // Only the total densities may be summed in single precision
+        field->MPIbuff.float_sums = smpi->float_sums && tagp > 0;
     }
 
     int patch_nbNeighbors_( 2 );
@@ -1043,33 +1336,35 @@ void Patch::initSumField( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
 
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             int tag = field->MPIbuff.send_tags_[iDim][iNeighbor];
-            if (devPtr) {
+            if( field->MPIbuff.float_sums ) {
+                field->MPIbuff.isendSum( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->size(),
+                                         MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi );
+            } else if (devPtr) {
                 // At initialization, we may not have everything on GPU SMILEI_GPU_ASSERT_MEMORY_IS_ON_DEVICE( field->sendFields_[iDim * 2 + iNeighbor]->data_ );
                 double* sendField = smilei::tools::gpu::HostDeviceMemoryManagement::GetDeviceOrHostPointer(field->sendFields_[iDim*2+iNeighbor]->data_);
                 // Assumes a GPU compatible MPI implementation
-                MPI_Isend( sendField, field->sendFields_[iDim*2+iNeighbor]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+                field->MPIbuff.isend( sendField, field->sendFields_[iDim*2+iNeighbor]->size(),
+                                      MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
             } else {
-                MPI_Isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+                field->MPIbuff.isend( field->sendFields_[iDim*2+iNeighbor]->data_, field->sendFields_[iDim*2+iNeighbor]->size(),
+                                      MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
             }
         } // END of Send
 
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tag = field->MPIbuff.recv_tags_[iDim][iNeighbor];
-            if (devPtr) {
+            if( field->MPIbuff.float_sums ) {
+                field->MPIbuff.irecvSum( field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
+                                         MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2 );
+            } else if (devPtr) {
                 // At initialization, we may not have everything on GPU SMILEI_GPU_ASSERT_MEMORY_IS_ON_DEVICE( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_ );
                 double* recvField = smilei::tools::gpu::HostDeviceMemoryManagement::GetDeviceOrHostPointer(field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_);
                 // Assumes a GPU compatible MPI implementation
-                MPI_Irecv( recvField, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+                field->MPIbuff.irecv( recvField, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
+                                      MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
             } else {
-                MPI_Irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
-                           MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                           MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+                field->MPIbuff.irecv( field->recvFields_[iDim*2+(iNeighbor+1)%2]->data_, field->recvFields_[iDim*2+(iNeighbor+1)%2]->size(),
+                                      MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
             }
         } // END of Recv
     } // END for iNeighbor
@@ -1092,7 +1387,12 @@ void Patch::finalizeSumField( Field *field, int iDim )
             MPI_Wait( &( field->MPIbuff.srequest[iDim][iNeighbor] ), &( sstat[iDim][iNeighbor] ) );
         }
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
-            MPI_Wait( &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ), &( rstat[iDim][( iNeighbor+1 )%2] ) );
+            if( field->MPIbuff.float_sums ) {
+                Field *recvField = field->recvFields_[iDim*2+( iNeighbor+1 )%2];
+                field->MPIbuff.waitSum( recvField->data_, recvField->size(), iDim, ( iNeighbor+1 )%2 );
+            } else {
+                MPI_Wait( &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ), &( rstat[iDim][( iNeighbor+1 )%2] ) );
+            }
         }
     }
 
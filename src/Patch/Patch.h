@@ -41,6 +41,7 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class HaloMessages;
 public:
     //! Constructor for Patch
     Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition, unsigned int ipatch );
@@ -174,9 +175,27 @@ public:
     //! effective exchange of particles
     void exchParticles( SmileiMPI *smpi, int ispec, Params &params, int iDim, VectorPatch *vecPatch );
     //! finalize exch / particles
-    void waitExchParticles( int ispec, int iDim );
+    void waitExchParticles( int ispec, int iDim, Params &params );
     //! Treat diagonalParticles
     void cornersParticles( int ispec, Params &params, int iDim );
+    
+    // Direct exchange of the particles with all the neighbors, corners included (Main.direct_particle_exchange)
+    //! compute the Hilbert index and MPI rank of the 3^ndim neighbors (only when the patch changed)
+    void updateDirectNeighbors( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition );
+    //! copy the leaving particles to the buffer of the neighbor they enter
+    void copyExchParticlesToDirectBuffers( int ispec, Params &params );
+    //! init comm  nbr of particles with all the neighbors
+    void exchNbrOfDirectParticles( SmileiMPI *smpi, int ispec, VectorPatch *vecPatch );
+    //! finalize comm / nbr of particles with all the neighbors
+    void endNbrOfDirectParticles( int ispec );
+    //! apply the periodicity, allocate the receive buffers and swap the buffers of local neighbors
+    void prepareDirectParticles( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! effective exchange of particles with all the neighbors
+    void exchDirectParticles( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! finalize exch / particles with all the neighbors
+    void waitExchDirectParticles( int ispec, Params &params );
+    //! move the particles received from the corners to the buffers of the faces, as expected by the sorting
+    void importCornerParticles( int ispec );
     //! inject particles received in main data structure and particles sorting
     void importAndSortParticles( int ispec, Params &params );
     //! clean memory resizing particles structure
@@ -306,6 +325,11 @@ public:
     {
         return( ( neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL ) && ( MPI_neighbor_[iDim][iNeighbor]!=MPI_me_ ) );
     }
+    // Test if the direct neighbor k (see direct_neighbor_) belongs to another MPI process
+    inline bool is_a_direct_MPI_neighbor( int k )
+    {
+        return( ( MPI_direct_neighbor_[k]!=MPI_PROC_NULL ) && ( MPI_direct_neighbor_[k]!=MPI_me_ ) );
+    }
     
     inline bool has_an_MPI_neighbor()
     {
@@ -458,6 +482,12 @@ protected:
     //! MPI rank of neighbors patch
     std::vector< std::vector<int> > MPI_neighbor_, tmp_MPI_neighbor_;
     
+    //! Hilbert index and MPI rank of all the neighbors patch, corners included (Main.direct_particle_exchange)
+    //!     - neighbor k has the offset ( k/3^iDim )%3 - 1 along iDim, k = (3^ndim-1)/2 is the patch itself
+    std::vector<int> direct_neighbor_, MPI_direct_neighbor_;
+    //! Hilbert index of the patch when direct_neighbor_ was computed (-1 if outdated)
+    int direct_neighbor_hindex_ = -1;
+    
     //! "Real" min limit of local sub-subdomain (ghost data not concerned)
     //!     - "0." on rank 0
     std::vector<double> min_local_;
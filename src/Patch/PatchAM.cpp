@@ -163,14 +163,14 @@ void PatchAM::initSumFieldComplex( Field *field, int iDim, SmileiMPI *smpi )
     
         if( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             int tag = field->MPIbuff.send_tags_[iDim][iNeighbor];
-            MPI_Isend( static_cast<cField*>(field->sendFields_[iDim*2+iNeighbor])->cdata_, 2*field->sendFields_[iDim*2+iNeighbor]->number_of_points_, MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.srequest[iDim][iNeighbor] ) );
+            field->MPIbuff.isend( reinterpret_cast<double *>( static_cast<cField*>(field->sendFields_[iDim*2+iNeighbor])->cdata_ ), 2*field->sendFields_[iDim*2+iNeighbor]->number_of_points_,
+                                  MPI_neighbor_[iDim][iNeighbor], tag, iDim, iNeighbor, smpi->persistent_communications );
         } // END of Send
         
         if( is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
             int tag = field->MPIbuff.recv_tags_[iDim][iNeighbor];
-            MPI_Irecv( static_cast<cField*>(field->recvFields_[iDim*2+(iNeighbor+1)%2])->cdata_, 2*field->recvFields_[iDim*2+(iNeighbor+1)%2]->number_of_points_, MPI_DOUBLE, MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag,
-                       MPI_COMM_WORLD, &( field->MPIbuff.rrequest[iDim][( iNeighbor+1 )%2] ) );
+            field->MPIbuff.irecv( reinterpret_cast<double *>( static_cast<cField*>(field->recvFields_[iDim*2+(iNeighbor+1)%2])->cdata_ ), 2*field->recvFields_[iDim*2+(iNeighbor+1)%2]->number_of_points_,
+                                  MPI_neighbor_[iDim][( iNeighbor+1 )%2], tag, iDim, ( iNeighbor+1 )%2, smpi->persistent_communications );
 
         } // END of Recv
         
@@ -1,6 +1,8 @@
 
 #include "SyncVectorPatch.h"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
     #include <openacc.h>
@@ -26,6 +28,11 @@ template void SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<complex<double>,c
 
 void SyncVectorPatch::initExchParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
 {
+    if( params.direct_particle_exchange ) {
+        SyncVectorPatch::initDirectExchParticles( vecPatches, ispec, params, smpi );
+        return;
+    }
+    
     #pragma omp for schedule(runtime)
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
         vecPatches( ipatch )->copyExchParticlesToBuffers( ispec, params );
@@ -43,6 +50,11 @@ void SyncVectorPatch::initExchParticles( VectorPatch &vecPatches, int ispec, Par
 // ---------------------------------------------------------------------------------------------------------------------
 void SyncVectorPatch::finalizeExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
 {
+    if( params.direct_particle_exchange ) {
+        SyncVectorPatch::finalizeDirectExchParticlesAndSort( vecPatches, ispec, params, smpi );
+        return;
+    }
+    
     // finish exchange along dimension 0 only
     SyncVectorPatch::finalizeExchParticlesAlongDimension( vecPatches, ispec, 0, params, smpi );
     
@@ -103,7 +115,7 @@ void SyncVectorPatch::finalizeExchParticlesAlongDimension( VectorPatch &vecPatch
     #pragma omp single
 #endif
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
-        vecPatches( ipatch )->waitExchParticles( ispec, iDim );
+        vecPatches( ipatch )->waitExchParticles( ispec, iDim, params );
     }
 
     #pragma omp for schedule(runtime)
@@ -113,6 +125,70 @@ void SyncVectorPatch::finalizeExchParticlesAlongDimension( VectorPatch &vecPatch
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Direct exchange (Main.direct_particle_exchange) : the particles are sent to any of the 3^ndim-1 neighbors,
+//! corners included, in a single exchange phase instead of one phase per dimension
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initDirectExchParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
+{
+    #pragma omp for schedule(runtime)
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->updateDirectNeighbors( params, smpi, vecPatches.domain_decomposition_ );
+        vecPatches( ipatch )->copyExchParticlesToDirectBuffers( ispec, params );
+    }
+    
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->exchNbrOfDirectParticles( smpi, ispec, &vecPatches );
+    }
+}
+
+void SyncVectorPatch::finalizeDirectExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
+{
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->endNbrOfDirectParticles( ispec );
+    }
+    
+    #pragma omp for schedule(runtime)
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->prepareDirectParticles( smpi, ispec, params, &vecPatches );
+    }
+    
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->exchDirectParticles( smpi, ispec, params, &vecPatches );
+    }
+    
+#ifndef _NO_MPI_TM
+    #pragma omp for schedule(runtime)
+#else
+    #pragma omp single
+#endif
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->waitExchDirectParticles( ispec, params );
+    }
+    
+    #pragma omp for schedule(runtime)
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        vecPatches( ipatch )->importCornerParticles( ispec );
+        vecPatches( ipatch )->importAndSortParticles( ispec, params );
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------       DENSITIES         ----------------------------------------------
@@ -639,13 +715,10 @@ void SyncVectorPatch::exchangeE( Params &params, VectorPatch &vecPatches, Smilei
     // E is exchange if spectral solver and/or at the end of initialisation of non-neutral plasma
 
     if( !params.full_B_exchange ) {
-        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listEx_, vecPatches, smpi );
-        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listEy_, vecPatches, smpi );
-        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listEz_, vecPatches, smpi );
+        // Ex, Ey and Ez exchanged together
+        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listE_, vecPatches, smpi );
     } else {
-        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listEx_, vecPatches, smpi );
-        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listEy_, vecPatches, smpi );
-        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listEz_, vecPatches, smpi );
+        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listE_, vecPatches, smpi );
     }
 
 }
@@ -656,9 +729,7 @@ void SyncVectorPatch::finalizeexchangeE( Params &params, VectorPatch &vecPatches
     // E is exchange if spectral solver and/or at the end of initialisation of non-neutral plasma
 
     if( !params.full_B_exchange ) {
-        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEx_, vecPatches );
-        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEy_, vecPatches );
-        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEz_, vecPatches );
+        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listE_, vecPatches );
     }
     //else
     //    done in exchangeSynchronizedPerDirection
@@ -673,12 +744,8 @@ void SyncVectorPatch::exchangeB( Params &params, VectorPatch &vecPatches, Smilei
         SyncVectorPatch::exchangeAllComponentsAlongX( vecPatches.Bs0, vecPatches, smpi );
     } else {
         if( params.full_B_exchange ) {
-            // Exchange Bx_ in Y then X
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listBx_, vecPatches, smpi );
-            // Exchange By_ in Y then X
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listBy_, vecPatches, smpi );
-            // Exchange Bz_ in Y then X
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listBz_, vecPatches, smpi );
+            // Exchange Bx_, By_ and Bz_ in Y then X
+            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listB_, vecPatches, smpi );
 
         } else {
             if( vecPatches.listBx_[0]->dims_.size()==2 ) {
@@ -732,46 +799,36 @@ void SyncVectorPatch::finalizeexchangeB( Params &params, VectorPatch &vecPatches
 void SyncVectorPatch::exchangeJ( Params &, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
 
-    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listJx_, vecPatches, smpi );
-    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listJy_, vecPatches, smpi );
-    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listJz_, vecPatches, smpi );
+    // Jx, Jy and Jz exchanged together
+    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.densities, vecPatches, smpi );
 }
 
 void SyncVectorPatch::finalizeexchangeJ( Params &, VectorPatch &vecPatches )
 {
 
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listJx_, vecPatches );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listJy_, vecPatches );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listJz_, vecPatches );
+    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.densities, vecPatches );
 }
 
 
 void SyncVectorPatch::exchangeB( Params &, VectorPatch &vecPatches, int imode, SmileiMPI *smpi )
 {
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listBl_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBl_[imode], vecPatches );
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listBr_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBr_[imode], vecPatches );
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listBt_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBt_[imode], vecPatches );
+    // Bl, Br and Bt of the mode exchanged together
+    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listB_AM_[imode], vecPatches, smpi );
+    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listB_AM_[imode], vecPatches );
 }
 
 void SyncVectorPatch::exchangeE( Params &, VectorPatch &vecPatches, int imode, SmileiMPI *smpi )
 {
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listEl_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEl_[imode], vecPatches );
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listEr_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEr_[imode], vecPatches );
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listEt_[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listEt_[imode], vecPatches );
+    // El, Er and Et of the mode exchanged together
+    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listE_AM_[imode], vecPatches, smpi );
+    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listE_AM_[imode], vecPatches );
 }
 
 void SyncVectorPatch::exchangeBmBTIS3( Params &/*params*/, VectorPatch &vecPatches, int imode, SmileiMPI *smpi )
 {
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listBr_mBTIS3[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBr_mBTIS3[imode], vecPatches );
-    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listBt_mBTIS3[imode], vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBt_mBTIS3[imode], vecPatches );
+    // Br_mBTIS3 and Bt_mBTIS3 of the mode exchanged together
+    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listB_mBTIS3_AM_[imode], vecPatches, smpi );
+    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listB_mBTIS3_AM_[imode], vecPatches );
 }
 
 // void SyncVectorPatch::finalizeexchangeB( Params &, VectorPatch &, int )
@@ -802,17 +859,12 @@ void SyncVectorPatch::exchangeBmBTIS3( Params &/*params*/, VectorPatch &vecPatch
 void SyncVectorPatch::exchangeA( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
     if( !params.full_Envelope_exchange ) {
-        // current envelope value
-        SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listA_, vecPatches, smpi );
-        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listA_, vecPatches );
-        // value of envelope at previous timestep
-        SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listA0_, vecPatches, smpi );
-        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listA0_, vecPatches );
+        // current envelope value and value at previous timestep
+        SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( vecPatches.listA_A0_, vecPatches, smpi );
+        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listA_A0_, vecPatches );
     } else {
-        // current envelope value
-        SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( vecPatches.listA_, vecPatches, smpi );
-        // value of envelope at previous timestep
-        SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( vecPatches.listA0_, vecPatches, smpi );
+        // current envelope value and value at previous timestep
+        SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( vecPatches.listA_A0_, vecPatches, smpi );
     }
 }
 
@@ -853,13 +905,9 @@ void SyncVectorPatch::exchangeEnvEx( Params &params, VectorPatch &vecPatches, Sm
 void SyncVectorPatch::exchangeBmBTIS3( Params &/*params*/, VectorPatch &vecPatches, SmileiMPI *smpi )
 {   // exchange BmBTIS3 in Cartesian geometries
 
-    // exchange ByBTIS3 
-    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listBy_mBTIS3, vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBy_mBTIS3, vecPatches );
-
-    // exchange BzBTIS3 
-    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listBz_mBTIS3, vecPatches, smpi );
-    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listBz_mBTIS3, vecPatches );
+    // exchange ByBTIS3 and BzBTIS3 together
+    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listB_mBTIS3, vecPatches, smpi );
+    SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listB_mBTIS3, vecPatches );
 }
 
 // void SyncVectorPatch::finalizeexchangeBmBTIS3( Params &params, VectorPatch &vecPatches )
@@ -901,50 +949,17 @@ void SyncVectorPatch::exchangeBmBTIS3( Params &/*params*/, VectorPatch &vecPatch
 
 void SyncVectorPatch::exchangeGradPhi( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
-    if (  params.geometry != "AMcylindrical" ) {
-        if( !params.full_Envelope_exchange ) {
-            // current Gradient value
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhix_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhix_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhiy_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhiy_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhiz_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhiz_, vecPatches );
-
-            // value of Gradient at previous timestep
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhix0_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhix0_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhiy0_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhiy0_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhiz0_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhiz0_, vecPatches );
-        } else {
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhix_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhiy_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhiz_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhix0_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhiy0_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhiz0_, vecPatches, smpi );
-        }
+    // All the components of the gradient exchanged together (x, y, z or l, r in AM)
+    if( !params.full_Envelope_exchange ) {
+        // current Gradient value
+        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhi_, vecPatches, smpi );
+        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhi_, vecPatches );
+        // value of Gradient at previous timestep
+        SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhi0_, vecPatches, smpi );
+        SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhi0_, vecPatches );
     } else {
-        if( !params.full_Envelope_exchange ) {
-            // current Gradient value
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhil_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhil_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhir_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhir_, vecPatches );
-
-            // value of Gradient at previous timestep
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhil0_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhil0_, vecPatches );
-            SyncVectorPatch::exchangeAlongAllDirections<double,Field>( vecPatches.listGradPhir0_, vecPatches, smpi );
-            SyncVectorPatch::finalizeExchangeAlongAllDirections( vecPatches.listGradPhir0_, vecPatches );
-        } else {
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhil_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhil0_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhir_, vecPatches, smpi );
-            SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhir0_, vecPatches, smpi );
-        }
+        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhi_, vecPatches, smpi );
+        SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( vecPatches.listGradPhi0_, vecPatches, smpi );
     }
 }
 
@@ -980,7 +995,76 @@ void SyncVectorPatch::templateGenerator()
     SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<double         ,Field >( patches.listEx_, patches, smpi );
 }
 
-// fields : contains a single field component (X, Y or Z) for all patches of vecPatches
+// Name of the exchange of a field list in HaloMessages: names of its components
+std::string SyncVectorPatch::exchangeName( std::vector<Field *> &fields, unsigned int nPatches )
+{
+    std::string name = fields[0]->name;
+    for( unsigned int ifield=nPatches ; ifield<fields.size() ; ifield += nPatches ) {
+        name += "," + fields[ifield]->name;
+    }
+    return name;
+}
+
+// Copy of the ghost cells along iDim between fields[ifield] and its neighbor on side 0, if it is in the same process
+// The field list is made of nComp components : fields[icomp*nPatches+ipatch] (see exchangeAlongAllDirections)
+template<typename T, typename F>
+void SyncVectorPatch::exchangeLocalGhosts( std::vector<Field *> &fields, unsigned int ifield, unsigned int iDim, VectorPatch &vecPatches )
+{
+    unsigned int nPatches = vecPatches.size();
+    unsigned int ipatch = ifield%nPatches;
+    if( vecPatches( ipatch )->MPI_me_ != vecPatches( ipatch )->MPI_neighbor_[iDim][0] ) {
+        return;
+    }
+
+    unsigned int oversize = vecPatches( 0 )->EMfields->oversize[iDim];
+    unsigned int size     = vecPatches( 0 )->EMfields->size_[iDim];
+    unsigned int h0       = vecPatches( 0 )->hindex;
+
+    unsigned int nx_, ny_( 1 ), nz_( 1 ), gsp;
+    nx_ = fields[ifield]->dims_[0];
+    if( fields[ifield]->dims_.size()>1 ) {
+        ny_ = fields[ifield]->dims_[1];
+        if( fields[ifield]->dims_.size()>2 ) {
+            nz_ = fields[ifield]->dims_[2];
+        }
+    }
+    gsp = ( oversize + 1 + fields[ifield]->isDual_[iDim] ); //Ghost size primal
+
+    F *field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[iDim][0]-h0+( ifield-ipatch )] );
+    F *field2 = static_cast<F *>( fields[ifield] );
+    T *pt1, *pt2;
+
+    if( iDim == 0 ) {
+        pt1 = &( *field1 )( size*ny_*nz_ );
+        pt2 = &( *field2 )( 0 );
+        memcpy( pt2, pt1, oversize*ny_*nz_*sizeof( T ) );
+        memcpy( pt1+gsp*ny_*nz_, pt2+gsp*ny_*nz_, oversize*ny_*nz_*sizeof( T ) );
+    } else if( iDim == 1 ) {
+        pt1 = &( *field1 )( size*nz_ );
+        pt2 = &( *field2 )( 0 );
+        for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
+            for( unsigned int j = 0 ; j < oversize*nz_ ; j++ ) {
+                pt2[i+j] = pt1[i+j] ;
+                pt1[i+j+gsp*nz_] = pt2[i+j+gsp*nz_] ;
+            }
+        }
+    } else {
+        pt1 = &( *field1 )( size );
+        pt2 = &( *field2 )( 0 );
+        for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
+            for( unsigned int j = 0 ; j < ny_*nz_ ; j += nz_ ) {
+                for( unsigned int k = 0 ; k < oversize ; k++ ) {
+                    pt2[i+j+k] = pt1[i+j+k] ;
+                    pt1[i+j+k+gsp] = pt2[i+j+k+gsp] ;
+                }
+            }
+        }
+    }
+}
+
+// fields : contains one or several field components for all patches of vecPatches, as in sum :
+//          fields[icomp*nPatches+ipatch] is the component icomp of the patch ipatch
+// All the components are exchanged along all the directions in a single epoch
 template<typename T, typename F>
 void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
@@ -989,93 +1073,55 @@ void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, V
     oversize[1] = vecPatches( 0 )->EMfields->oversize[1];
     oversize[2] = vecPatches( 0 )->EMfields->oversize[2];
 
-    for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
+    unsigned int nPatches = vecPatches.size();
+    unsigned int nDim = fields[0]->dims_.size();
+
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+    #pragma omp for schedule(static)
 #else
-        #pragma omp single
+    #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-                if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
-                    fields[ipatch]->create_sub_fields  ( iDim, iNeighbor, oversize[iDim] );
-                    fields[ipatch]->extract_fields_exch( iDim, iNeighbor, oversize[iDim] );
+    // The components of a patch share their tags : they are posted in order by the same thread
+    for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
+        for( unsigned int ifield=ipatch ; ifield<fields.size() ; ifield += nPatches ) {
+            for( unsigned int iDim=0 ; iDim<nDim ; iDim++ ) {
+                for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+                    if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                        fields[ifield]->create_sub_fields  ( iDim, iNeighbor, oversize[iDim] );
+                        fields[ifield]->extract_fields_exch( iDim, iNeighbor, oversize[iDim] );
+                    }
                 }
+                if ( smpi->aggregate_communications )
+                    continue;
+                if ( !dynamic_cast<cField*>( fields[ifield] ) )
+                    vecPatches( ipatch )->initExchange       ( fields[ifield], iDim, smpi );
+                else
+                    vecPatches( ipatch )->initExchangeComplex( fields[ifield], iDim, smpi );
             }
-            if ( !dynamic_cast<cField*>( fields[ipatch] ) )
-                vecPatches( ipatch )->initExchange       ( fields[ipatch], iDim, smpi );
-            else
-                vecPatches( ipatch )->initExchangeComplex( fields[ipatch], iDim, smpi );
         }
-    } // End for iDim
-
-    unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, size[3], gsp[3];
-    T *pt1, *pt2;
-    F *field1, *field2;
-    h0 = vecPatches( 0 )->hindex;
-
-    size[0] = vecPatches( 0 )->EMfields->size_[0];
-    size[1] = vecPatches( 0 )->EMfields->size_[1];
-    size[2] = vecPatches( 0 )->EMfields->size_[2];
+    }
 
-    nx_ = fields[0]->dims_[0];
-    if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
-        if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
+    if( smpi->aggregate_communications ) {
+        // One message per neighbor process, direction and side
+        #pragma omp single
+        {
+            std::vector<int> patches( nPatches );
+            for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
+                patches[ipatch] = ipatch;
+            }
+            std::string name = exchangeName( fields, nPatches );
+            for( unsigned int iDim=0 ; iDim<nDim ; iDim++ ) {
+                vecPatches.halo_messages_.post( name, fields, patches, iDim, vecPatches, smpi );
+            }
         }
     }
 
-
-    gsp[0] = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
-
-    #pragma omp for schedule(static) private(pt1,pt2)
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-
-        if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[0][0] ) {
-            field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[0][0]-h0] );
-            field2 = static_cast<F *>( fields[ipatch] );
-            pt1 = &( *field1 )( ( size[0] )*ny_*nz_ );
-            pt2 = &( *field2 )( 0 );
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( T ) );
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( T ) );
-        } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
-
-        if( fields[0]->dims_.size()>1 ) {
-            gsp[1] = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
-            if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[1][0] ) {
-                field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[1][0]-h0] );
-                field2 = static_cast<F *>( fields[ipatch] );
-                pt1 = &( *field1 )( size[1]*nz_ );
-                pt2 = &( *field2 )( 0 );
-                for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
-                    for( unsigned int j = 0 ; j < oversize[1]*nz_ ; j++ ) {
-                        // Rewrite with memcpy ?
-                        pt2[i+j] = pt1[i+j] ;
-                        pt1[i+j+gsp[1]*nz_] = pt2[i+j+gsp[1]*nz_] ;
-                    }
-                }
-            } // End if ( MPI_me_ == MPI_neighbor_[1][0] )
-
-            if( fields[0]->dims_.size()>2 ) {
-                gsp[2] = ( oversize[2] + 1 + fields[0]->isDual_[2] ); //Ghost size primal
-                if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[2][0] ) {
-                    field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[2][0]-h0] );
-                    field2 = static_cast<F *>( fields[ipatch] );
-                    pt1 = &( *field1 )( size[2] );
-                    pt2 = &( *field2 )( 0 );
-                    for( unsigned int i = 0 ; i < nx_*ny_*nz_ ; i += ny_*nz_ ) {
-                        for( unsigned int j = 0 ; j < ny_*nz_ ; j += nz_ ) {
-                            for( unsigned int k = 0 ; k < oversize[2] ; k++ ) {
-                                pt2[i+j+k] = pt1[i+j+k] ;
-                                pt1[i+j+k+gsp[2]] = pt2[i+j+k+gsp[2]] ;
-                            }
-                        }
-                    }
-                }// End if ( MPI_me_ == MPI_neighbor_[2][0] )
-            }// End if dims_.size()>2
-        } // End if dims_.size()>1
-    } // End for( ipatch )
+    #pragma omp for schedule(static)
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        for( unsigned int iDim=0 ; iDim<nDim ; iDim++ ) {
+            exchangeLocalGhosts<T,F>( fields, ifield, iDim, vecPatches );
+        }
+    } // End for( ifield )
 
 }
 
@@ -1087,22 +1133,35 @@ void SyncVectorPatch::finalizeExchangeAlongAllDirections( std::vector<Field *> f
     oversize[1] = vecPatches( 0 )->EMfields->oversize[1];
     oversize[2] = vecPatches( 0 )->EMfields->oversize[2];
 
-    for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
+    unsigned int nPatches = vecPatches.size();
+    unsigned int nDim = fields[0]->dims_.size();
+
+    const std::string name = exchangeName( fields, nPatches );
+    const bool aggregated = vecPatches.halo_messages_.aggregates( name );
+    if( aggregated ) {
+        #pragma omp single
+        vecPatches.halo_messages_.wait( name );
+    }
+
 #ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
+    #pragma omp for schedule(static)
 #else
-        #pragma omp single
+    #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->finalizeExchange( fields[ipatch], iDim );
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        unsigned int ipatch = ifield%nPatches;
+        for( unsigned int iDim=0 ; iDim<nDim ; iDim++ ) {
+            if( !aggregated ) {
+                vecPatches( ipatch )->finalizeExchange( fields[ifield], iDim );
+            }
 
             for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                 if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
-                    fields[ipatch]->inject_fields_exch( iDim, iNeighbor, oversize[iDim] );
+                    fields[ifield]->inject_fields_exch( iDim, iNeighbor, oversize[iDim] );
                 }
             }
         }
-    } // End for iDim
+    }
 
 }
 
@@ -1234,199 +1293,80 @@ template void SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,
 template<typename T, typename F>
 void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi )
 {
-
-    unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, oversize[3], size[3], gsp[3];
-    T *pt1, *pt2;
-    F* field1;
-    F* field2;
-    h0 = vecPatches( 0 )->hindex;
-
+    unsigned int oversize[3];
     oversize[0] = vecPatches( 0 )->EMfields->oversize[0];
     oversize[1] = vecPatches( 0 )->EMfields->oversize[1];
     oversize[2] = vecPatches( 0 )->EMfields->oversize[2];
 
-    size[0] = vecPatches( 0 )->EMfields->size_[0];
-    size[1] = vecPatches( 0 )->EMfields->size_[1];
-    size[2] = vecPatches( 0 )->EMfields->size_[2];
-
-    nx_ = fields[0]->dims_[0];
-    if( fields[0]->dims_.size()>1 ) {
-        ny_ = fields[0]->dims_[1];
-        if( fields[0]->dims_.size()>2 ) {
-            nz_ = fields[0]->dims_[2];
-        }
+    // Several components may be exchanged together (see exchangeAlongAllDirections)
+    unsigned int nPatches = vecPatches.size();
+    std::string name;
+    if( smpi->aggregate_communications ) {
+        name = exchangeName( fields, nPatches );
     }
 
-    if( fields[0]->dims_.size()>2 ) {
+    // Dimension 2, then 1, then 0
+    for( int iDim = std::max( ( int )fields[0]->dims_.size(), 2 )-1 ; iDim>=0 ; iDim-- ) {
 
-        // Dimension 2
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
 #else
         #pragma omp single
 #endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-                if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, iNeighbor ) ) {
-                    fields[ipatch]->create_sub_fields  ( 2, iNeighbor, oversize[2] );
-                    fields[ipatch]->extract_fields_exch( 2, iNeighbor, oversize[2] );
+        for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
+            // The components of a patch share their tags : they are posted in order by the same thread
+            for( unsigned int ifield=ipatch ; ifield<fields.size() ; ifield += nPatches ) {
+                for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+                    if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                        fields[ifield]->create_sub_fields  ( iDim, iNeighbor, oversize[iDim] );
+                        fields[ifield]->extract_fields_exch( iDim, iNeighbor, oversize[iDim] );
+                    }
                 }
+                if ( smpi->aggregate_communications )
+                    continue;
+                if ( !dynamic_cast<cField*>( fields[ifield] ) )
+                    vecPatches( ipatch )->initExchange( fields[ifield], iDim, smpi );
+                else
+                    vecPatches( ipatch )->initExchangeComplex( fields[ifield], iDim, smpi );
             }
-            if ( !dynamic_cast<cField*>( fields[ipatch] ) )
-                vecPatches( ipatch )->initExchange( fields[ipatch], 2, smpi );
-            else
-                vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 2, smpi );
         }
-        
 
-#ifndef _NO_MPI_TM
-        #pragma omp for schedule(static)
-#else
-        #pragma omp single
-#endif
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 2 );
-
-            for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-                if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
-                    fields[ipatch]->inject_fields_exch( 2, iNeighbor, oversize[2] );
+        if( smpi->aggregate_communications ) {
+            #pragma omp single
+            {
+                std::vector<int> patches( nPatches );
+                for( unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++ ) {
+                    patches[ipatch] = ipatch;
                 }
+                vecPatches.halo_messages_.post( name, fields, patches, iDim, vecPatches, smpi );
+                vecPatches.halo_messages_.wait( name );
             }
         }
 
-        #pragma omp for schedule(static) private(pt1,pt2)
-        for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-
-            gsp[2] = ( oversize[2] + 1 + fields[0]->isDual_[2] ); //Ghost size primal
-            if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[2][0] ) {
-                field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[2][0]-h0]  );
-                field2 = static_cast<F *>( fields[ipatch] );
-                pt1 = &( *field1 )( size[2] );
-                pt2 = &( *field2 )( 0 );
-                //for (unsigned int in = oversize[0] ; in < nx_-oversize[0]; in ++){
-                for( unsigned int in = 0 ; in < nx_ ; in ++ ) {
-                    unsigned int i = in * ny_*nz_;
-                    //for (unsigned int jn = oversize[1] ; jn < ny_-oversize[1] ; jn ++){
-                    for( unsigned int jn = 0 ; jn < ny_ ; jn ++ ) {
-                        unsigned int j = jn *nz_;
-                        for( unsigned int k = 0 ; k < oversize[2] ; k++ ) {
-                            pt2[i+j+k] = pt1[i+j+k] ;
-                            pt1[i+j+k+gsp[2]] = pt2[i+j+k+gsp[2]] ;
-                        }
-                    }
-                }
-            }// End if ( MPI_me_ == MPI_neighbor_[2][0] )
-
-        } // End for( ipatch )
-    }
-
-    // Dimension 1
 #ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
-#else
-    #pragma omp single
-#endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-            if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, iNeighbor ) ) {
-                fields[ipatch]->create_sub_fields  ( 1, iNeighbor, oversize[1] );
-                fields[ipatch]->extract_fields_exch( 1, iNeighbor, oversize[1] );
-            }
-        }
-        if ( !dynamic_cast<cField*>( fields[ipatch] ) )
-            vecPatches( ipatch )->initExchange( fields[ipatch], 1, smpi );
-        else
-            vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 1, smpi );
-    }
-
-#ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
+        #pragma omp for schedule(static)
 #else
-    #pragma omp single
+        #pragma omp single
 #endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 1 );
-
-        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-            if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
-                fields[ipatch]->inject_fields_exch( 1, iNeighbor, oversize[1] );
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            unsigned int ipatch = ifield%nPatches;
+            if( !smpi->aggregate_communications ) {
+                vecPatches( ipatch )->finalizeExchange( fields[ifield], iDim );
             }
-        }
-    }
-
-    #pragma omp for schedule(static) private(pt1,pt2)
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
 
-        gsp[1] = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
-        if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[1][0] ) {
-            field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[1][0]-h0]  );
-            field2 = static_cast<F *>( fields[ipatch] );
-            pt1 = &( *field1 )( size[1]*nz_ );
-            pt2 = &( *field2 )( 0 );
-            for( unsigned int in = 0 ; in < nx_ ; in ++ ) {
-                //for (unsigned int in = oversize[0] ; in < nx_-oversize[0] ; in ++){ // <== This doesn't work. Why ??
-                unsigned int i = in * ny_*nz_;
-                for( unsigned int j = 0 ; j < oversize[1]*nz_ ; j++ ) {
-                    // Rewrite with memcpy ?
-                    pt2[i+j] = pt1[i+j] ;
-                    pt1[i+j+gsp[1]*nz_] = pt2[i+j+gsp[1]*nz_] ;
+            for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+                if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
+                    fields[ifield]->inject_fields_exch( iDim, iNeighbor, oversize[iDim] );
                 }
             }
-        } // End if ( MPI_me_ == MPI_neighbor_[1][0] )
-
-    } // End for( ipatch )
-
-    // Dimension 0
-#ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
-#else
-    #pragma omp single
-#endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-            if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, iNeighbor ) ) {
-                fields[ipatch]->create_sub_fields  ( 0, iNeighbor, oversize[0] );
-                fields[ipatch]->extract_fields_exch( 0, iNeighbor, oversize[0] );
-            }
-        }
-        if ( !dynamic_cast<cField*>( fields[ipatch] ) )
-            vecPatches( ipatch )->initExchange( fields[ipatch], 0, smpi );
-        else
-            vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 0, smpi );
-    }
-
-#ifndef _NO_MPI_TM
-    #pragma omp for schedule(static)
-#else
-    #pragma omp single
-#endif
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 0 );
-
-        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
-            if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
-                fields[ipatch]->inject_fields_exch( 0, iNeighbor, oversize[0] );
-            }
         }
-    }
-
-
-
-    gsp[0] = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
 
-    #pragma omp for schedule(static) private(pt1,pt2)
-    for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-
-        if( vecPatches( ipatch )->MPI_me_ == vecPatches( ipatch )->MPI_neighbor_[0][0] ) {
-            field1 = static_cast<F *>( fields[vecPatches( ipatch )->neighbor_[0][0]-h0]  );
-            field2 = static_cast<F *>( fields[ipatch] );
-            pt1 = &( *field1 )( ( size[0] )*ny_*nz_ );
-            pt2 = &( *field2 )( 0 );
-            memcpy( pt2, pt1, oversize[0]*ny_*nz_*sizeof( T ) );
-            memcpy( pt1+gsp[0]*ny_*nz_, pt2+gsp[0]*ny_*nz_, oversize[0]*ny_*nz_*sizeof( T ) );
-        } // End if ( MPI_me_ == MPI_neighbor_[0][0] )
+        #pragma omp for schedule(static)
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            exchangeLocalGhosts<T,F>( fields, ifield, iDim, vecPatches );
+        } // End for( ifield )
 
-    } // End for( ipatch )
+    } // End for iDim
 
 }
 
@@ -1467,8 +1407,14 @@ void SyncVectorPatch::exchangeAllComponentsAlongX( std::vector<Field *> &fields,
 #endif
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi, true ); // By
-        vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi, true ); // Bz
+        if( !smpi->aggregate_communications ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield      ], 0, smpi, true ); // By
+            vecPatches( ipatch )->initExchange( vecPatches.B_MPIx[ifield+nMPIx], 0, smpi, true ); // Bz
+        }
+    }
+    if( smpi->aggregate_communications ) {
+        #pragma omp single
+        vecPatches.halo_messages_.post( "Bs0", vecPatches.B_MPIx, vecPatches.MPIxIdx, 0, vecPatches, smpi );
     }
 
     unsigned int h0, size;
@@ -1538,6 +1484,11 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongX( VectorPatch &vecPatch
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[0];
 
     unsigned int nMPIx = vecPatches.MPIxIdx.size();
+    const bool aggregated = vecPatches.halo_messages_.aggregates( "Bs0" );
+    if( aggregated ) {
+        #pragma omp single
+        vecPatches.halo_messages_.wait( "Bs0" );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1545,8 +1496,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongX( VectorPatch &vecPatch
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIx ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        if( !aggregated ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield      ], 0 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B_MPIx[ifield+nMPIx], 0 ); // Bz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -1603,8 +1556,14 @@ void SyncVectorPatch::exchangeAllComponentsAlongY( std::vector<Field *> &fields,
 #endif
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi, true ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi, true ); // Bz
+        if( !smpi->aggregate_communications ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield      ], 1, smpi, true ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1, smpi, true ); // Bz
+        }
+    }
+    if( smpi->aggregate_communications ) {
+        #pragma omp single
+        vecPatches.halo_messages_.post( "Bs1", vecPatches.B1_MPIy, vecPatches.MPIyIdx, 1, vecPatches, smpi );
     }
 
     unsigned int h0, size;
@@ -1669,6 +1628,11 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongY( VectorPatch &vecPatch
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[1];
 
     unsigned int nMPIy = vecPatches.MPIyIdx.size();
+    const bool aggregated = vecPatches.halo_messages_.aggregates( "Bs1" );
+    if( aggregated ) {
+        #pragma omp single
+        vecPatches.halo_messages_.wait( "Bs1" );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1676,8 +1640,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongY( VectorPatch &vecPatch
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIy ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        if( !aggregated ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield      ], 1 ); // By
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B1_MPIy[ifield+nMPIy], 1 ); // Bz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -1734,8 +1700,14 @@ void SyncVectorPatch::exchangeAllComponentsAlongZ( std::vector<Field *> fields,
 #endif
             }
         }
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi, true ); // Bx
-        vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi, true ); // By
+        if( !smpi->aggregate_communications ) {
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield],       2, smpi, true ); // Bx
+            vecPatches( ipatch )->initExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2, smpi, true ); // By
+        }
+    }
+    if( smpi->aggregate_communications ) {
+        #pragma omp single
+        vecPatches.halo_messages_.post( "Bs2", vecPatches.B2_MPIz, vecPatches.MPIzIdx, 2, vecPatches, smpi );
     }
 
     unsigned int h0, size;
@@ -1797,6 +1769,11 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongZ( VectorPatch &vecPatch
     unsigned oversize = vecPatches( 0 )->EMfields->oversize[2];
 
     unsigned int nMPIz = vecPatches.MPIzIdx.size();
+    const bool aggregated = vecPatches.halo_messages_.aggregates( "Bs2" );
+    if( aggregated ) {
+        #pragma omp single
+        vecPatches.halo_messages_.wait( "Bs2" );
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -1804,8 +1781,10 @@ void SyncVectorPatch::finalizeExchangeAllComponentsAlongZ( VectorPatch &vecPatch
 #endif
     for( unsigned int ifield=0 ; ifield<nMPIz ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
-        vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        if( !aggregated ) {
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield      ], 2 ); // Bx
+            vecPatches( ipatch )->finalizeExchange( vecPatches.B2_MPIz[ifield+nMPIz], 2 ); // By
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -21,6 +21,8 @@ public :
     static void finalizeExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
     static void initExchParticlesAlongDimension( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi );
     static void finalizeExchParticlesAlongDimension( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi );
+    static void initDirectExchParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
+    static void finalizeDirectExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
 
     //! Densities synchronization
     static void sumRhoJ( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
@@ -404,6 +406,7 @@ public :
     // static void finalizeexchangeGradPhi( Params &params, VectorPatch &vecPatches );
     static void exchangeEnvChi( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
 
+    //! fields may contain several components (fields[icomp*nPatches+ipatch]), exchanged in a single epoch
     template<typename T, typename MT> static void exchangeAlongAllDirections( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
     static void finalizeExchangeAlongAllDirections( std::vector<Field *> fields, VectorPatch &vecPatches );
 
@@ -413,6 +416,11 @@ public :
     template<typename T, typename MT> static void exchangeSynchronizedPerDirection( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
     static void exchangeSynchronizedPerDirection( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
 
+    //! Name of the exchange of a field list in HaloMessages
+    static std::string exchangeName( std::vector<Field *> &fields, unsigned int nPatches );
+    //! Copy of the ghost cells along iDim between fields[ifield] and its neighbor in the same process
+    template<typename T, typename F> static void exchangeLocalGhosts( std::vector<Field *> &fields, unsigned int ifield, unsigned int iDim, VectorPatch &vecPatches );
+
     static void exchangeAllComponentsAlongX( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
     static void finalizeExchangeAllComponentsAlongX( VectorPatch &vecPatches );
     static void exchangeAllComponentsAlongY( std::vector<Field *> &fields, VectorPatch &vecPatches, SmileiMPI *smpi );
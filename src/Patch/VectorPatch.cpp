@@ -420,6 +420,11 @@ void VectorPatch::projectionForDiags( Params &params,
 void VectorPatch::initExchParticles( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
         double time_dual, Timers &timers, int itime )
 {
+    // Already started patch by patch in dynamicsWithoutTasks
+    if( params.pipelined_particle_exchange ) {
+        return;
+    }
+
     timers.syncPart.restart();
     for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
         if( species( 0, ispec )->hasMoved( time_dual, simWindow ) ) {
@@ -980,63 +985,90 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
                 }
             }
             if (params.geometry != "AMcylindrical"){
+                // Jx, Jy and Jz exchanged together
                 if (params.currentFilter_model=="customFIR"){
-                    SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJx_, *this, smpi );
-                    SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJy_, *this, smpi );
-                    SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJz_, *this, smpi );
+                    SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( densities, *this, smpi );
                 } else {
-                    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( listJx_, *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJx_, *this );
-                    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( listJy_, *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJy_, *this );
-                    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( listJz_, *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJz_, *this );
+                    SyncVectorPatch::exchangeAlongAllDirections<double,Field>( densities, *this, smpi );
+                    SyncVectorPatch::finalizeExchangeAlongAllDirections( densities, *this );
                 }
             } else {
                 for (unsigned int imode=0 ; imode < params.nmodes; imode++) {
-                    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( listJl_[imode], *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJl_[imode], *this );
-                    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( listJr_[imode], *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJr_[imode], *this );
-                    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( listJt_[imode], *this, smpi );
-                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJt_[imode], *this );
+                    SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( listJ_AM_[imode], *this, smpi );
+                    SyncVectorPatch::finalizeExchangeAlongAllDirections( listJ_AM_[imode], *this );
                 }
             }
         }
     }
 
-    #pragma omp for schedule(static)
-    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        if( !params.is_spectral ) {
-            // Saving magnetic fields (to compute centered fields used in the particle pusher)
-            // Stores B at time n in B_m.
-            ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
+    // With fused field loops, Maxwell-Ampere is done in the same loop as Maxwell-Faraday:
+    // both solvers only read the fields of their own patch, so that no barrier is needed in between.
+    // The patches are then distributed dynamically to absorb the differences of cost between them.
+    if( !params.fused_field_loops ) {
+        #pragma omp for schedule(static)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            solveMaxwellAmpere( params, ipatch );
         }
-        // Computes Ex_, Ey_, Ez_ on all points.
-        // E is already synchronized because J has been synchronized before.
-        ( *( *this )( ipatch )->EMfields->MaxwellAmpereSolver_ )( ( *this )( ipatch )->EMfields );
     }
 
-    #pragma omp for schedule(static)
-    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        // Computes Bx_, By_, Bz_ at time n+1 on interior points.
-        ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
-    }
-    //Synchronize B fields between patches.
-    timers.maxwell.update( params.printNow( itime ) );
-
+    if( params.maxwell_overlap_communications ) {
+        // Computes B on the layers sent to the neighbors, starts the exchange, then computes the interiors
+        if( params.fused_field_loops ) {
+            #pragma omp for schedule(dynamic)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                solveMaxwellAmpere( params, ipatch );
+                ( *this )( ipatch )->EMfields->MaxwellFaradaySolver_->boundaryLayers( ( *this )( ipatch )->EMfields );
+            }
+        } else {
+            #pragma omp for schedule(static)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                ( *this )( ipatch )->EMfields->MaxwellFaradaySolver_->boundaryLayers( ( *this )( ipatch )->EMfields );
+            }
+        }
+        timers.maxwell.update( params.printNow( itime ) );
 
-    timers.syncField.restart();
-    if( params.geometry != "AMcylindrical" ) {
-        if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
+        timers.syncField.restart();
         SyncVectorPatch::exchangeB( params, ( *this ), smpi );
+        timers.syncField.update( params.printNow( itime ) );
+
+        timers.maxwell.restart();
+        #pragma omp for schedule(static)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ( *this )( ipatch )->EMfields->MaxwellFaradaySolver_->interior( ( *this )( ipatch )->EMfields );
+        }
+        timers.maxwell.update( params.printNow( itime ) );
+
     } else {
-        for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
-            if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
-            SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+
+        if( params.fused_field_loops ) {
+            #pragma omp for schedule(dynamic)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                solveMaxwellAmpere( params, ipatch );
+                ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+            }
+        } else {
+            #pragma omp for schedule(static)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                // Computes Bx_, By_, Bz_ at time n+1 on interior points.
+                ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+            }
+        }
+        //Synchronize B fields between patches.
+        timers.maxwell.update( params.printNow( itime ) );
+
+
+        timers.syncField.restart();
+        if( params.geometry != "AMcylindrical" ) {
+            if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
+            SyncVectorPatch::exchangeB( params, ( *this ), smpi );
+        } else {
+            for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
+                if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
+                SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+            }
         }
+        timers.syncField.update( params.printNow( itime ) );
     }
-    timers.syncField.update( params.printNow( itime ) );
 
 
     if ( (params.multiple_decomposition) && ( itime!=0 ) && ( time_dual > params.time_fields_frozen ) ) { // multiple_decomposition = true -> is_spectral = true
@@ -1084,6 +1116,21 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
 
 } // END solveMaxwell
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Maxwell-Ampere solver of one patch (saves B at time n beforehand, for the centering of B)
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::solveMaxwellAmpere( Params &params, unsigned int ipatch )
+{
+    if( !params.is_spectral && !params.maxwell_temporal_blocking ) {
+        // Saving magnetic fields (to compute centered fields used in the particle pusher)
+        // Stores B at time n in B_m (done by the Maxwell-Ampere solver with temporal blocking).
+        ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
+    }
+    // Computes Ex_, Ey_, Ez_ on all points.
+    // E is already synchronized because J has been synchronized before.
+    ( *( *this )( ipatch )->EMfields->MaxwellAmpereSolver_ )( ( *this )( ipatch )->EMfields );
+}
+
 void VectorPatch::solveEnvelope( Params &params, SimWindow *simWindow, int, double time_dual, Timers &timers, SmileiMPI *smpi )
 {
 
@@ -1152,27 +1199,39 @@ void VectorPatch::finalizeSyncAndBCFields( Params &params, SmileiMPI *smpi, SimW
         }
 
         timers.maxwellBC.restart();
-        SMILEI_PY_SAVE_MASTER_THREAD
-        #pragma omp for schedule(static)
-        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-            // Applies boundary conditions on B
-            if ( (!params.is_spectral) || (params.geometry!= "AMcylindrical") )
+        if( params.fused_field_loops ) {
+            // Without PML, the boundary conditions and the centering of B only touch the fields of each patch:
+            // their loops are fused, without a barrier in between
+            SMILEI_PY_SAVE_MASTER_THREAD
+            #pragma omp for schedule(dynamic)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
                 ( *this )( ipatch )->EMfields->boundaryConditions( time_dual, ( *this )( ipatch ), simWindow );
+                ( *this )( ipatch )->EMfields->centerMagneticFields();
+            }
+            SMILEI_PY_RESTORE_MASTER_THREAD
+        } else {
+            SMILEI_PY_SAVE_MASTER_THREAD
+            #pragma omp for schedule(static)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                // Applies boundary conditions on B
+                if ( (!params.is_spectral) || (params.geometry!= "AMcylindrical") )
+                    ( *this )( ipatch )->EMfields->boundaryConditions( time_dual, ( *this )( ipatch ), simWindow );
 
-        }
-        SMILEI_PY_RESTORE_MASTER_THREAD
-        SyncVectorPatch::exchangeForPML( params, (*this), smpi );
+            }
+            SMILEI_PY_RESTORE_MASTER_THREAD
+            SyncVectorPatch::exchangeForPML( params, (*this), smpi );
 
-        #pragma omp for schedule(static)
-        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-            // Computes B at time n using B and B_m.
-            if( !params.is_spectral ) {
-                ( *this )( ipatch )->EMfields->centerMagneticFields();
+            #pragma omp for schedule(static)
+            for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+                // Computes B at time n using B and B_m.
+                if( !params.is_spectral ) {
+                    ( *this )( ipatch )->EMfields->centerMagneticFields();
+                }
+                //Done at domain initializtion
+                //else {
+                //    ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
+                //}
             }
-            //Done at domain initializtion
-            //else {
-            //    ( *this )( ipatch )->EMfields->saveMagneticFields( params.is_spectral );
-            //}
         }
         timers.maxwellBC.update( params.printNow( itime ) );
     }
@@ -3200,6 +3259,37 @@ void VectorPatch::updateFieldList( SmileiMPI *smpi )
             }
         }
 
+        // Components exchanged together
+        listE_.resize( 3*size() );
+        listB_.resize( 3*size() );
+        for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+            listE_[ipatch         ] = listEx_[ipatch];
+            listE_[ipatch+  size()] = listEy_[ipatch];
+            listE_[ipatch+2*size()] = listEz_[ipatch];
+            listB_[ipatch         ] = listBx_[ipatch];
+            listB_[ipatch+  size()] = listBy_[ipatch];
+            listB_[ipatch+2*size()] = listBz_[ipatch];
+        }
+        if (smpi->use_BTIS3){
+            listB_mBTIS3.resize( 2*size() );
+            for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+                listB_mBTIS3[ipatch       ] = listBy_mBTIS3[ipatch];
+                listB_mBTIS3[ipatch+size()] = listBz_mBTIS3[ipatch];
+            }
+        }
+        if( patches_[0]->EMfields->envelope != NULL ) {
+            listGradPhi_.resize( 3*size() );
+            listGradPhi0_.resize( 3*size() );
+            for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+                listGradPhi_ [ipatch         ] = listGradPhix_ [ipatch];
+                listGradPhi_ [ipatch+  size()] = listGradPhiy_ [ipatch];
+                listGradPhi_ [ipatch+2*size()] = listGradPhiz_ [ipatch];
+                listGradPhi0_[ipatch         ] = listGradPhix0_[ipatch];
+                listGradPhi0_[ipatch+  size()] = listGradPhiy0_[ipatch];
+                listGradPhi0_[ipatch+2*size()] = listGradPhiz0_[ipatch];
+            }
+        }
+
     } else {
         unsigned int nmodes = static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size();
         listJl_.resize( nmodes ) ;
@@ -3294,6 +3384,56 @@ void VectorPatch::updateFieldList( SmileiMPI *smpi )
             }
         }
 
+        // Components exchanged together
+        listJ_AM_.resize( nmodes );
+        listE_AM_.resize( nmodes );
+        listB_AM_.resize( nmodes );
+        if (smpi->use_BTIS3){
+            listB_mBTIS3_AM_.resize( nmodes );
+        }
+        for( unsigned int imode=0 ; imode < nmodes ; imode++ ) {
+            listJ_AM_[imode].resize( 3*size() );
+            listE_AM_[imode].resize( 3*size() );
+            listB_AM_[imode].resize( 3*size() );
+            for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+                listJ_AM_[imode][ipatch         ] = listJl_[imode][ipatch];
+                listJ_AM_[imode][ipatch+  size()] = listJr_[imode][ipatch];
+                listJ_AM_[imode][ipatch+2*size()] = listJt_[imode][ipatch];
+                listE_AM_[imode][ipatch         ] = listEl_[imode][ipatch];
+                listE_AM_[imode][ipatch+  size()] = listEr_[imode][ipatch];
+                listE_AM_[imode][ipatch+2*size()] = listEt_[imode][ipatch];
+                listB_AM_[imode][ipatch         ] = listBl_[imode][ipatch];
+                listB_AM_[imode][ipatch+  size()] = listBr_[imode][ipatch];
+                listB_AM_[imode][ipatch+2*size()] = listBt_[imode][ipatch];
+            }
+            if (smpi->use_BTIS3){
+                listB_mBTIS3_AM_[imode].resize( 2*size() );
+                for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+                    listB_mBTIS3_AM_[imode][ipatch       ] = listBr_mBTIS3[imode][ipatch];
+                    listB_mBTIS3_AM_[imode][ipatch+size()] = listBt_mBTIS3[imode][ipatch];
+                }
+            }
+        }
+        if( patches_[0]->EMfields->envelope != NULL ) {
+            listGradPhi_.resize( 2*size() );
+            listGradPhi0_.resize( 2*size() );
+            for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+                listGradPhi_ [ipatch       ] = listGradPhil_ [ipatch];
+                listGradPhi_ [ipatch+size()] = listGradPhir_ [ipatch];
+                listGradPhi0_[ipatch       ] = listGradPhil0_[ipatch];
+                listGradPhi0_[ipatch+size()] = listGradPhir0_[ipatch];
+            }
+        }
+
+    }
+
+    // A and A0 of the envelope, exchanged together
+    if( patches_[0]->EMfields->envelope != NULL ) {
+        listA_A0_.resize( 2*size() );
+        for( unsigned int ipatch=0 ; ipatch < size() ; ipatch++ ) {
+            listA_A0_[ipatch       ] = listA_[ipatch];
+            listA_A0_[ipatch+size()] = listA0_[ipatch];
+        }
     }
 
     B_localx.clear();
@@ -4829,6 +4969,26 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
                 } // end if condition on species
             } // end loop on species
             //MESSAGE("species dynamics");
+
+            if( params.pipelined_particle_exchange ) {
+                // The particles leaving the patch are copied to the buffers and their numbers are sent along x
+                // (or to all the neighbors with direct_particle_exchange)
+                // while the other patches are still moving their particles (see initExchParticles)
+                for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
+                    if( ! species( ipatch, ispec )->hasMoved( time_dual, simWindow ) ) {
+                        continue;
+                    }
+                    if( params.direct_particle_exchange ) {
+                        ( *this )( ipatch )->updateDirectNeighbors( params, smpi, domain_decomposition_ );
+                        ( *this )( ipatch )->copyExchParticlesToDirectBuffers( ispec, params );
+                        ( *this )( ipatch )->exchNbrOfDirectParticles( smpi, ispec, this );
+                    } else {
+                        ( *this )( ipatch )->copyExchParticlesToBuffers( ispec, params );
+                        ( *this )( ipatch )->exchNbrOfParticles( smpi, ispec, params, 0, this );
+                    }
+                }
+                smpi->progressCommunications();
+            }
         } // end loop on patches
     SMILEI_PY_RESTORE_MASTER_THREAD
 }
@@ -14,6 +14,7 @@
 #include "Checkpoint.h"
 #include "OpenPMDparams.h"
 #include "SmileiMPI.h"
+#include "HaloMessages.h"
 #include "SimWindow.h"
 #include "Timers.h"
 #include "RadiationTables.h"
@@ -220,6 +221,9 @@ public :
     //! For all patch, update E and B (Ampere, Faraday, boundary conditions, exchange B and center B)
     void solveMaxwell( Params &params, SimWindow *simWindow, int itime, double time_dual,
                        Timers &timers, SmileiMPI *smpi );
+    
+    //! For one patch, save B at time n and update E (Ampere)
+    void solveMaxwellAmpere( Params &params, unsigned int ipatch );
                        
     //! For all patch, update envelope field A (envelope equation, boundary contitions, exchange A)
     void solveEnvelope( Params &params, SimWindow *simWindow, int itime, double time_dual, Timers &timers, SmileiMPI *smpi );
@@ -338,6 +342,9 @@ public :
     std::vector<Field *> B2_localz;
     std::vector<Field *> B2_MPIz;
     
+    //! Halo messages aggregated per neighbor MPI process (Main.aggregate_communications)
+    HaloMessages halo_messages_;
+    
     std::vector<Field *> listJx_;
     std::vector<Field *> listJy_;
     std::vector<Field *> listJz_;
@@ -356,6 +363,14 @@ public :
     std::vector<Field *> listBz_mBTIS3;
     std::vector<Field *> listForPML_;
     
+    //! Components exchanged together (fields[icomp*size()+ipatch], see SyncVectorPatch::exchangeAlongAllDirections)
+    std::vector<Field *> listE_;       // Ex, Ey, Ez
+    std::vector<Field *> listB_;       // Bx, By, Bz
+    std::vector<Field *> listB_mBTIS3; // By_mBTIS3, Bz_mBTIS3
+    std::vector<Field *> listA_A0_;    // A, A0
+    std::vector<Field *> listGradPhi_; // GradPhix, GradPhiy, GradPhiz (GradPhil, GradPhir in AM)
+    std::vector<Field *> listGradPhi0_;
+    
     std::vector<Field *> listA_;
     std::vector<Field *> listA0_;
     // std::vector<Field *> listEnvE_;
@@ -393,6 +408,11 @@ public :
     std::vector<std::vector< Field *>> listBt_;
     std::vector<std::vector< Field *>> listBr_mBTIS3;
     std::vector<std::vector< Field *>> listBt_mBTIS3;
+    //! Components exchanged together, per mode
+    std::vector<std::vector< Field *>> listJ_AM_;       // Jl, Jr, Jt
+    std::vector<std::vector< Field *>> listE_AM_;       // El, Er, Et
+    std::vector<std::vector< Field *>> listB_AM_;       // Bl, Br, Bt
+    std::vector<std::vector< Field *>> listB_mBTIS3_AM_; // Br_mBTIS3, Bt_mBTIS3
     
     
     //! True if any antennas
@@ -0,0 +1,100 @@
+#ifndef PROJECTOR3D2ORDERSIMD_H
+#define PROJECTOR3D2ORDERSIMD_H
+
+#include "Simd.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Explicit-SIMD version of Projector3D2OrderV::computeJ (config=simd_kernels)
+//! The buffers use the layout of the vectorized projector: 8 lanes per node ([node*8+ipart]).
+//! One call deposits the Esirkepov current of the 8 lanes of a block, the lanes above the number
+//! of particles of the block must hold a zero charge_weight, DS and S0.
+//! The operations are done in the same order as computeJ (see Simd.h for the round-off).
+//  --------------------------------------------------------------------------------------------------------------------
+
+namespace smilei {
+    namespace tools {
+        namespace simd {
+
+            //! Current deposited by the V::width lanes starting at ipart
+            template<typename V>
+            inline void computeJLanes( int ipart, const double *charge_weight,
+                                       const double *DSx, const double *DSy, const double *DSz,
+                                       const double *Sy0, const double *Sz0, double *bJx,
+                                       double dxovdt, int nx, int ny, int nz )
+            {
+                const int vecSize = 8;
+                const V one_third( 1./3. );
+                const V half( 0.5 );
+
+                const V crx_p = V::load( charge_weight + ipart ) * V( dxovdt );
+
+                V sum[5];
+                sum[0] = V( 0. );
+                for( int k=1 ; k<5 ; k++ ) {
+                    sum[k] = sum[k-1] - V::load( DSx + ( k-1 )*vecSize + ipart );
+                }
+
+                const V DSy0 = V::load( DSy + ipart );
+                const V DSz0 = V::load( DSz + ipart );
+
+                V tmp = crx_p * ( one_third*DSy0*DSz0 );
+                for( int i=1 ; i<5 ; i++ ) {
+                    double *b = bJx + ( i*nx )*vecSize + ipart;
+                    ( V::load( b ) + sum[i]*tmp ).store( b );
+                }
+
+                for( int k=1 ; k<5 ; k++ ) {
+                    tmp = crx_p * ( half*DSy0*V::load( Sz0 + ( k-1 )*vecSize + ipart )
+                                    + one_third*DSy0*V::load( DSz + k*vecSize + ipart ) );
+                    const int index = ( k*nz )*vecSize + ipart;
+                    for( int i=1 ; i<5 ; i++ ) {
+                        double *b = bJx + index + nx*i*vecSize;
+                        ( V::load( b ) + sum[i]*tmp ).store( b );
+                    }
+                }
+
+                for( int j=1 ; j<5 ; j++ ) {
+                    tmp = crx_p * ( half*DSz0*V::load( Sy0 + ( j-1 )*vecSize + ipart )
+                                    + one_third*V::load( DSy + j*vecSize + ipart )*DSz0 );
+                    const int index = ( j*ny )*vecSize + ipart;
+                    for( int i=1 ; i<5 ; i++ ) {
+                        double *b = bJx + index + nx*i*vecSize;
+                        ( V::load( b ) + sum[i]*tmp ).store( b );
+                    }
+                }
+
+                for( int j=1 ; j<5 ; j++ ) {
+                    const V Sy0j = V::load( Sy0 + ( j-1 )*vecSize + ipart );
+                    const V DSyj = V::load( DSy + j*vecSize + ipart );
+                    for( int k=1 ; k<5 ; k++ ) {
+                        const V Sz0k = V::load( Sz0 + ( k-1 )*vecSize + ipart );
+                        const V DSzk = V::load( DSz + k*vecSize + ipart );
+                        tmp = crx_p * ( Sy0j*Sz0k
+                                        + half*DSyj*Sz0k
+                                        + half*DSzk*Sy0j
+                                        + one_third*DSyj*DSzk );
+                        const int index = ( j*ny + k*nz )*vecSize + ipart;
+                        for( int i=1 ; i<5 ; i++ ) {
+                            double *b = bJx + index + nx*i*vecSize;
+                            ( V::load( b ) + sum[i]*tmp ).store( b );
+                        }
+                    }
+                }
+            }
+
+            //! Current deposited by the 8 lanes of a block
+            inline void computeJ( const double *charge_weight,
+                                  const double *DSx, const double *DSy, const double *DSz,
+                                  const double *Sy0, const double *Sz0, double *bJx,
+                                  double dxovdt, int nx, int ny, int nz )
+            {
+                for( int ipart=0 ; ipart<8 ; ipart += Vector::width ) {
+                    computeJLanes<Vector>( ipart, charge_weight, DSx, DSy, DSz, Sy0, Sz0, bJx, dxovdt, nx, ny, nz );
+                }
+            }
+
+        } // namespace simd
+    } // namespace tools
+} // namespace smilei
+
+#endif
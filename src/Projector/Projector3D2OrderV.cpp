@@ -8,8 +8,14 @@
 #include "Particles.h"
 #include "Tools.h"
 #include "Patch.h"
+#if defined( SMILEI_SIMD_KERNELS )
+#include "Projector3D2OrderSimd.h"
+#endif
 
 using namespace std;
+#if defined( SMILEI_SIMD_KERNELS )
+namespace simd = smilei::tools::simd;
+#endif
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -38,6 +44,9 @@ Projector3D2OrderV::Projector3D2OrderV( Params &params, Patch *patch ) : Project
     dq_inv[0] = dx_inv_;
     dq_inv[1] = dy_inv_;
     dq_inv[2] = dz_inv_;
+#if defined( SMILEI_SIMD_KERNELS )
+    simd_kernels_ = true;
+#endif
 
     dt             = params.timestep;
     dts2           = params.timestep/2.;
@@ -69,7 +78,9 @@ void Projector3D2OrderV::currentsAndDensity( double * __restrict__ Jx,
                                              int    * __restrict__ iold,
                                              double * __restrict__ deltaold,
                                              unsigned int buffer_size,
-                                             int ipart_ref, int bin_shift )
+                                             int ipart_ref, int bin_shift,
+                                             int    * __restrict__ node_index,
+                                             double * __restrict__ node_delta )
 {
 
     // -------------------------------------
@@ -96,7 +107,7 @@ void Projector3D2OrderV::currentsAndDensity( double * __restrict__ Jx,
     // Closest multiple of 8 higher or equal than npart = iend-istart.
     int cell_nparts( ( int )iend-( int )istart );
     // Jx, Jy, Jz
-    currents( Jx, Jy, Jz, particles, istart, iend, invgf, iold, deltaold, buffer_size, ipart_ref, bin_shift );
+    currents( Jx, Jy, Jz, particles, istart, iend, invgf, iold, deltaold, buffer_size, ipart_ref, bin_shift, node_index, node_delta );
 
 
     // rho^(p,p,d)
@@ -111,10 +122,18 @@ void Projector3D2OrderV::currentsAndDensity( double * __restrict__ Jx,
         int np_computed( min( cell_nparts-ivect, vecSize ) );
         int istart0 = ( int )istart + ivect;
 
-        #pragma omp simd
-        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( particles, buffer_size, ipart, istart0, ipart_ref, deltaold, iold, DSx, DSy, DSz );
-            charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
+        if( node_index ) {
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                compute_distances_from_projector_nodes( node_index, node_delta, buffer_size, ipart, istart0, ipart_ref, iold, DSx, DSy, DSz );
+                charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
+            }
+        } else {
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                compute_distances( particles, buffer_size, ipart, istart0, ipart_ref, deltaold, iold, DSx, DSy, DSz );
+                charge_weight[ipart] = inv_cell_volume * ( double )( particles.charge( istart0+ipart ) )*particles.weight( istart0+ipart );
+            }
         }
 
         #pragma omp simd
@@ -381,7 +400,9 @@ void Projector3D2OrderV::currents( double * __restrict__ Jx,
                                    int    * __restrict__ iold,
                                    double * __restrict__ deltaold,
                                    unsigned int buffer_size,
-                                   int ipart_ref, int bin_shift )
+                                   int ipart_ref, int bin_shift,
+                                   int    * __restrict__ node_index,
+                                   double * __restrict__ node_delta )
 {
     // -------------------------------------
     // Variable declaration & initialization
@@ -436,14 +457,48 @@ void Projector3D2OrderV::currents( double * __restrict__ Jx,
         int np_computed( min( cell_nparts-ivect, vecSize ) );
         int istart0 = ( int )istart + ivect;
 
-        #pragma omp simd
-        for( int ipart=0 ; ipart<np_computed; ipart++ ) {
-            compute_distances( position_x, position_y, position_z,
-                               (int)(buffer_size), ipart, istart0, ipart_ref, deltaold, iold,
-                               Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
-            charge_weight[ipart] = inv_cell_volume * ( double )( charge[istart0+ipart] )*weight[istart0+ipart];
+        if( node_index ) {
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                compute_distances_from_projector_nodes( node_index, node_delta,
+                                                     (int)(buffer_size), ipart, istart0, ipart_ref, deltaold, iold,
+                                                     Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
+                charge_weight[ipart] = inv_cell_volume * ( double )( charge[istart0+ipart] )*weight[istart0+ipart];
+            }
+        } else {
+            #pragma omp simd
+            for( int ipart=0 ; ipart<np_computed; ipart++ ) {
+                compute_distances( position_x, position_y, position_z,
+                                   (int)(buffer_size), ipart, istart0, ipart_ref, deltaold, iold,
+                                   Sx0_buff_vect, Sy0_buff_vect, Sz0_buff_vect, DSx, DSy, DSz );
+                charge_weight[ipart] = inv_cell_volume * ( double )( charge[istart0+ipart] )*weight[istart0+ipart];
+            }
         }
 
+#if defined( SMILEI_SIMD_KERNELS )
+        if( simd_kernels_ ) {
+            // The explicit-SIMD kernel always works on the 8 lanes: the lanes without particle deposit zero
+            for( int ipart=np_computed ; ipart<vecSize; ipart++ ) {
+                charge_weight[ipart] = 0.;
+                for( int k=0 ; k<4 ; k++ ) {
+                    Sx0_buff_vect[k*vecSize+ipart] = 0.;
+                    Sy0_buff_vect[k*vecSize+ipart] = 0.;
+                    Sz0_buff_vect[k*vecSize+ipart] = 0.;
+                }
+                for( int k=0 ; k<5 ; k++ ) {
+                    DSx[k*vecSize+ipart] = 0.;
+                    DSy[k*vecSize+ipart] = 0.;
+                    DSz[k*vecSize+ipart] = 0.;
+                }
+            }
+
+            simd::computeJ( charge_weight, DSx, DSy, DSz, Sy0_buff_vect, Sz0_buff_vect, bJx, dx_ov_dt_, 25, 5, 1 );
+            simd::computeJ( charge_weight, DSy, DSx, DSz, Sx0_buff_vect, Sz0_buff_vect, bJy, dy_ov_dt_, 5, 25, 1 );
+            simd::computeJ( charge_weight, DSz, DSx, DSy, Sx0_buff_vect, Sy0_buff_vect, bJz, dz_ov_dt_, 1, 25, 5 );
+            continue;
+        }
+#endif
+
         #pragma omp simd
         for( int ipart=0 ; ipart<np_computed; ipart++ ) {
             computeJ( ipart, charge_weight, DSx, DSy, DSz, Sy0_buff_vect, Sz0_buff_vect, bJx, dx_ov_dt_, 25, 5, 1 );
@@ -539,6 +594,14 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
     std::vector<double> *delta = &( smpi->dynamics_deltaold[ithread] );
     std::vector<double> *invgf = &( smpi->dynamics_invgf[ithread] );
     //}
+
+    // New primal node of the particles, when already computed with the cell keys
+    int    *node_index  = nullptr;
+    double *node_delta = nullptr;
+    if( !smpi->dynamics_projector_inew[ithread].empty() ) {
+        node_index  = smpi->dynamics_projector_inew[ithread].data();
+        node_delta = smpi->dynamics_projector_deltanew[ithread].data();
+    }
     int iold[3];
 
     iold[0] = scell/( nscelly*nscellz )+oversize[0];
@@ -553,7 +616,7 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
             double *b_Jx =  &( *EMfields->Jx_ )( 0 );
             double *b_Jy =  &( *EMfields->Jy_ )( 0 );
             double *b_Jz =  &( *EMfields->Jz_ )( 0 );
-            currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf->data(), iold, &( *delta )[0], invgf->size(), ipart_ref );
+            currents( b_Jx, b_Jy, b_Jz, particles,  istart, iend, invgf->data(), iold, &( *delta )[0], invgf->size(), ipart_ref, 0, node_index, node_delta );
         } else {
             ERROR( "TO DO with rho" );
         }
@@ -564,7 +627,7 @@ void Projector3D2OrderV::currentsAndDensityWrapper( ElectroMagn *EMfields,
         double *b_Jy  = EMfields->Jy_s [ispec] ? &( *EMfields->Jy_s [ispec] )( 0 ) : &( *EMfields->Jy_ )( 0 ) ;
         double *b_Jz  = EMfields->Jz_s [ispec] ? &( *EMfields->Jz_s [ispec] )( 0 ) : &( *EMfields->Jz_ )( 0 ) ;
         double *b_rho = EMfields->rho_s[ispec] ? &( *EMfields->rho_s[ispec] )( 0 ) : &( *EMfields->rho_ )( 0 ) ;
-        currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  istart, iend, invgf->data(), iold, &( *delta )[0], invgf->size(), ipart_ref );
+        currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  istart, iend, invgf->data(), iold, &( *delta )[0], invgf->size(), ipart_ref, 0, node_index, node_delta );
     }
 }
 
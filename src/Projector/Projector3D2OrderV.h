@@ -21,7 +21,9 @@ public:
                           int    * __restrict__ iold,
                           double * __restrict__ deltaold,
                           unsigned int buffer_size,
-                          int ipart_ref = 0, int bin_shift = 0);
+                          int ipart_ref = 0, int bin_shift = 0,
+                          int    * __restrict__ node_index = nullptr,
+                          double * __restrict__ node_delta = nullptr );
 
     //! Project global current densities (EMfields->Jx_/Jy_/Jz_/rho), diagFields timestep
     inline void currentsAndDensity( double * __restrict__ Jx,
@@ -35,7 +37,9 @@ public:
                                     int    * __restrict__ iold,
                                     double * __restrict__ deltaold,
                                     unsigned int buffer_size,
-                                    int ipart_ref = 0, int bin_shift = 0 );
+                                    int ipart_ref = 0, int bin_shift = 0,
+                                    int    * __restrict__ node_index = nullptr,
+                                    double * __restrict__ node_delta = nullptr );
 
     //! Project global current charge (EMfields->rho_), frozen & diagFields timestep
     void basic( double *rhoj, Particles &particles, unsigned int ipart, unsigned int bin, int bin_shift = 0 ) override final;
@@ -48,6 +52,12 @@ public:
     
     void susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int icell, int ipart_ref ) override;
 
+#if defined( SMILEI_SIMD_KERNELS )
+    //! Use the explicit-SIMD kernels (default) rather than the `#pragma omp simd` loops,
+    //! switched off by smilei_simd_bench to compare both
+    bool simd_kernels_;
+#endif
+
 private:
     double dt, dts2, dts4;
 
@@ -281,6 +291,81 @@ private:
 
     };
 
+    //! Same as compute_distances, but the new primal node of the particle and its distance to this node
+    //! are read from the buffers filled with the cell keys (SpeciesV::computeParticleCellKeysAndProjectorNodes)
+    //! instead of being recomputed from the positions
+    inline void __attribute__((always_inline)) compute_distances_from_projector_nodes( const int * __restrict__ node_index,
+                                    const double * __restrict__ node_delta,
+                                    int npart_total, int ipart, int istart, int ipart_ref,
+                                    double *delta0, int *iold, double *Sx0, double *Sy0,
+                                    double *Sz0, double *DSx, double *DSy, double *DSz )
+    {
+        int vecSize = 8;
+
+        double *S0[3] = { Sx0, Sy0, Sz0 };
+        double *DS[3] = { DSx, DSy, DSz };
+
+        UNROLL_S(3)
+        for( int idim=0 ; idim<3 ; idim++ ) {
+            int ibuffer = istart-ipart_ref+ipart+idim*npart_total;
+
+            double delta = delta0[ibuffer];
+            double delta2 = delta*delta;
+
+            S0[idim][          ipart] = 0.5 * ( delta2-delta+0.25 );
+            S0[idim][  vecSize+ipart] = 0.75-delta2;
+            S0[idim][2*vecSize+ipart] = 0.5 * ( delta2+delta+0.25 );
+            S0[idim][3*vecSize+ipart] = 0.;
+
+            // node_index is relative to the first cell of the patch, iold includes the oversize
+            int cell_shift = node_index[ibuffer]-iold[idim]+oversize[idim];
+            delta  = node_delta[ibuffer];
+            delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            DS[idim][          ipart] = m1 * deltam                             ;
+            DS[idim][  vecSize+ipart] = c0 * deltam + m1 * delta2               -  S0[idim][          ipart];
+            DS[idim][2*vecSize+ipart] = p1 * deltam + c0 * delta2 + m1* deltap  -  S0[idim][  vecSize+ipart];
+            DS[idim][3*vecSize+ipart] =               p1 * delta2 + c0* deltap  -  S0[idim][2*vecSize+ipart];
+            DS[idim][4*vecSize+ipart] =                             p1* deltap  ;
+        }
+    };
+
+    //! Same as compute_distances for the density, with the new cell index and offset read from the buffers
+    inline void __attribute__((always_inline)) compute_distances_from_projector_nodes( const int * __restrict__ node_index,
+                                    const double * __restrict__ node_delta,
+                                    int npart_total, int ipart, int istart, int ipart_ref,
+                                    int *iold, double *Sx1, double *Sy1, double *Sz1 )
+    {
+        int vecSize = 8;
+
+        double *S1[3] = { Sx1, Sy1, Sz1 };
+
+        UNROLL_S(3)
+        for( int idim=0 ; idim<3 ; idim++ ) {
+            int ibuffer = istart-ipart_ref+ipart+idim*npart_total;
+
+            int cell_shift = node_index[ibuffer]-iold[idim]+oversize[idim];
+            double delta  = node_delta[ibuffer];
+            double delta2 = delta*delta;
+            double deltam =  0.5 * ( delta2-delta+0.25 );
+            double deltap =  0.5 * ( delta2+delta+0.25 );
+            delta2 = 0.75 - delta2;
+            double m1 = ( cell_shift == -1 );
+            double c0 = ( cell_shift ==  0 );
+            double p1 = ( cell_shift ==  1 );
+            S1[idim][          ipart] = m1 * deltam                            ;
+            S1[idim][  vecSize+ipart] = c0 * deltam + m1 * delta2              ;
+            S1[idim][2*vecSize+ipart] = p1 * deltam + c0 * delta2 + m1* deltap ;
+            S1[idim][3*vecSize+ipart] =               p1 * delta2 + c0* deltap ;
+            S1[idim][4*vecSize+ipart] =                             p1* deltap ;
+        }
+    };
+
     inline void __attribute__((always_inline)) computeJ( int ipart, double *charge_weight,
                                                         double *DSx, double *DSy, double *DSz,
                                                         double *Sy0, double *Sz0, double *bJx,
@@ -4,7 +4,8 @@
 
 Pusher::Pusher( Params &params, Species *species ) :
     min_loc_vec( species->min_loc_vec ),
-    vecto( params.vectorization_mode=="on" || params.vectorization_mode=="adaptive_mixed_sort" || params.vectorization_mode=="adaptive" || params.cell_sorting_ )
+    vecto( params.vectorization_mode=="on" || params.vectorization_mode=="adaptive_mixed_sort" || params.vectorization_mode=="adaptive" || params.cell_sorting_ ),
+    mixed_precision_( species->mixed_precision_ )
 {
     for( unsigned int ipos=0; ipos < params.nDim_particle ; ipos++ ) {
         dx_inv_[ipos] = species->dx_inv_[ipos];
@@ -33,6 +33,8 @@ protected:
     double dx_inv_[3];
     unsigned int nspace[3];
     bool vecto;
+    //! Interpolated fields are read from the single-precision buffers
+    bool mixed_precision_;
 };//END class
 
 #endif
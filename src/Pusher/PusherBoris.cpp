@@ -7,12 +7,14 @@
 #include "Species.h"
 
 
-PusherBoris::PusherBoris( Params &params, Species *species )
+template <int nDim>
+PusherBoris<nDim>::PusherBoris( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherBoris::~PusherBoris()
+template <int nDim>
+PusherBoris<nDim>::~PusherBoris()
 {
 }
 
@@ -20,11 +22,29 @@ PusherBoris::~PusherBoris()
     Lorentz Force -- leap-frog (Boris) scheme
 ***********************************************************************/
 
-void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherBoris<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+{
+#if !defined( SMILEI_ACCELERATOR_GPU )
+    if( mixed_precision_ ) {
+        pushParticles( particles, smpi, istart, iend, ithread, ipart_buffer_offset,
+                       smpi->dynamics_Epart_float[ithread].data(), smpi->dynamics_Bpart_float[ithread].data() );
+        return;
+    }
+#endif
+    pushParticles( particles, smpi, istart, iend, ithread, ipart_buffer_offset,
+                   smpi->dynamics_Epart[ithread].data(), smpi->dynamics_Bpart[ithread].data() );
+}
+
+//! Push with the interpolated fields read from Epart_buffer and Bpart_buffer (double, or float for mixed precision)
+template <int nDim>
+template<typename field_t>
+void PusherBoris<nDim>::pushParticles( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                                 const field_t *Epart_buffer, const field_t *Bpart_buffer )
 {
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
 
     double *const __restrict__ momentum_x = particles.getPtrMomentum( 0 );
     double *const __restrict__ momentum_y = particles.getPtrMomentum( 1 );
@@ -36,12 +56,12 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
 
     const int nparts = particles.last_index.back(); // particles.size()
 
-    const double *const __restrict__ Ex = &( ( smpi->dynamics_Epart[ithread] )[0*nparts] );
-    const double *const __restrict__ Ey = &( ( smpi->dynamics_Epart[ithread] )[1*nparts] );
-    const double *const __restrict__ Ez = &( ( smpi->dynamics_Epart[ithread] )[2*nparts] );
-    const double *const __restrict__ Bx = &( ( smpi->dynamics_Bpart[ithread] )[0*nparts] );
-    const double *const __restrict__ By = &( ( smpi->dynamics_Bpart[ithread] )[1*nparts] );
-    const double *const __restrict__ Bz = &( ( smpi->dynamics_Bpart[ithread] )[2*nparts] );
+    const field_t *const __restrict__ Ex = &( Epart_buffer[0*nparts] );
+    const field_t *const __restrict__ Ey = &( Epart_buffer[1*nparts] );
+    const field_t *const __restrict__ Ez = &( Epart_buffer[2*nparts] );
+    const field_t *const __restrict__ Bx = &( Bpart_buffer[0*nparts] );
+    const field_t *const __restrict__ By = &( Bpart_buffer[1*nparts] );
+    const field_t *const __restrict__ Bz = &( Bpart_buffer[2*nparts] );
 
 #if defined( SMILEI_ACCELERATOR_GPU_OMP )
     const int istart_offset   = istart - ipart_buffer_offset;
@@ -118,9 +138,9 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
         local_invgf *= dt;
         // position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart2];
         position_x[ipart] += pxsm*local_invgf;
-        if( nDim_ > 1 ) {
+        if( nDim > 1 ) {
             position_y[ipart] += pysm*local_invgf;
-            if( nDim_ > 2 ) {
+            if( nDim > 2 ) {
                 position_z[ipart] += pzsm*local_invgf;
             }
         }
@@ -140,3 +160,8 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
     //     }
     // }
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherBoris<1>;
+template class PusherBoris<2>;
+template class PusherBoris<3>;
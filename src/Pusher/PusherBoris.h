@@ -12,7 +12,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherBorisV
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherBoris : public Pusher
 {
 public:
@@ -21,6 +24,12 @@ public:
     ~PusherBoris();
     //! Overloading of () operator
     void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset = 0 ) override;
+
+private:
+    //! Push kernel, templated on the precision of the interpolated fields
+    template<typename field_t>
+    void pushParticles( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                        const field_t *Epart_buffer, const field_t *Bpart_buffer );
 };
 
 #endif
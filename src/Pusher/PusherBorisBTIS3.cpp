@@ -12,12 +12,14 @@
 
 using namespace std;
 
-PusherBorisBTIS3::PusherBorisBTIS3( Params &params, Species *species )
+template <int nDim>
+PusherBorisBTIS3<nDim>::PusherBorisBTIS3( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherBorisBTIS3::~PusherBorisBTIS3()
+template <int nDim>
+PusherBorisBTIS3<nDim>::~PusherBorisBTIS3()
 {
 }
 
@@ -25,15 +27,16 @@ PusherBorisBTIS3::~PusherBorisBTIS3()
     Lorentz Force -- leap-frog (Boris) scheme
 ***********************************************************************/
 
-void PusherBorisBTIS3::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherBorisBTIS3<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
 {
 
     const int nparts = vecto ? smpi->dynamics_Epart[ithread].size() / 3 :
                                particles.last_index.back(); // particles.size()
 
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
     
     double *const __restrict__ momentum_x = particles.getPtrMomentum(0);
     double *const __restrict__ momentum_y = particles.getPtrMomentum(1);
@@ -124,9 +127,9 @@ void PusherBorisBTIS3::operator()( Particles &particles, SmileiMPI *smpi, int is
         local_invgf *= dt;
         //position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart2];
         position_x[ipart] += pxsm*local_invgf;
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += pysm*local_invgf;
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += pzsm*local_invgf;
             }
         }
@@ -146,3 +149,8 @@ void PusherBorisBTIS3::operator()( Particles &particles, SmileiMPI *smpi, int is
     //     }
     // }
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherBorisBTIS3<1>;
+template class PusherBorisBTIS3<2>;
+template class PusherBorisBTIS3<3>;
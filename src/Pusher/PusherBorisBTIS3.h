@@ -12,7 +12,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherBorisV
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherBorisBTIS3 : public Pusher
 {
 public:
@@ -5,12 +5,14 @@
 #include "PusherBorisNR.h"
 #include "Particles.h"
 
-PusherBorisNR::PusherBorisNR( Params &params, Species *species )
+template <int nDim>
+PusherBorisNR<nDim>::PusherBorisNR( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherBorisNR::~PusherBorisNR()
+template <int nDim>
+PusherBorisNR<nDim>::~PusherBorisNR()
 {
 }
 
@@ -18,7 +20,8 @@ PusherBorisNR::~PusherBorisNR()
     Lorentz Force -- leap-frog (Boris) scheme
 ***********************************************************************/
 
-void PusherBorisNR::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherBorisNR<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
 {
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
@@ -34,8 +37,8 @@ void PusherBorisNR::operator()( Particles &particles, SmileiMPI *smpi, int istar
     const double *const __restrict__ Bz = &( ( *Bpart )[2*nparts] );
 
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
 
     double *const __restrict__ momentum_x = particles.getPtrMomentum( 0 );
     double *const __restrict__ momentum_y = particles.getPtrMomentum( 1 );
@@ -115,9 +118,9 @@ void PusherBorisNR::operator()( Particles &particles, SmileiMPI *smpi, int istar
 
         // Move the particle
         position_x[ipart] += dt * momentum_x[ipart];
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += dt * momentum_y[ipart];
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += dt * momentum_z[ipart];
             }
         }
@@ -145,3 +148,8 @@ void PusherBorisNR::operator()( Particles &particles, SmileiMPI *smpi, int istar
     // }
 
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherBorisNR<1>;
+template class PusherBorisNR<2>;
+template class PusherBorisNR<3>;
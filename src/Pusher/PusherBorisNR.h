@@ -12,7 +12,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherBorisNR
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherBorisNR : public Pusher
 {
 public:
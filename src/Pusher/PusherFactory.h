@@ -33,6 +33,21 @@
 class PusherFactory
 {
 public:
+    //  --------------------------------------------------------------------------------------------------------------------
+    //! Instantiate the pusher PusherType for the number of dimensions of the particle positions
+    //  --------------------------------------------------------------------------------------------------------------------
+    template <template <int> class PusherType>
+    static Pusher *createForDimension( Params &params, Species *species )
+    {
+        if( params.nDim_particle == 1 ) {
+            return new PusherType<1>( params, species );
+        } else if( params.nDim_particle == 2 ) {
+            return new PusherType<2>( params, species );
+        } else {
+            return new PusherType<3>( params, species );
+        }
+    }
+
     //  --------------------------------------------------------------------------------------------------------------------
     //! Create appropriate pusher for the species ispec
     //! \param ispec SpeciesId
@@ -47,7 +62,7 @@ public:
             // assign the correct Pusher to Push
             // Pusher of Boris
             if( species->pusher_name_ == "boris" ) {
-                    Push = new PusherBoris( params, species );
+                    Push = createForDimension<PusherBoris>( params, species );
             } else if( species->pusher_name_ == "ponderomotive_boris" ) {
             
                 int n_envlaser = params.Laser_Envelope_model;
@@ -60,19 +75,19 @@ public:
                 Push = new PusherPonderomotiveBoris( params, species );
             // Non-relativistic Boris pusher
             } else if( species->pusher_name_ == "borisnr" ) {
-                Push = new PusherBorisNR( params, species );
+                Push = createForDimension<PusherBorisNR>( params, species );
             }
             // Pusher of J.L. Vay
             else if( species->pusher_name_ == "vay" ) {
-                Push = new PusherVay( params, species );
+                Push = createForDimension<PusherVay>( params, species );
             // Pusher of Higuera Cary
             } else if( species->pusher_name_ == "higueracary" ) {
-                Push = new PusherHigueraCary( params, species );
+                Push = createForDimension<PusherHigueraCary>( params, species );
             } else if (species->pusher_name_ == "borisBTIS3"){
                 if (!params.use_BTIS3){
                     ERROR("Pusher borisBTIS3 can be used only if use_BTIS3 = True in Main block");
                 } else {
-                    Push = new PusherBorisBTIS3( params, species );
+                    Push = createForDimension<PusherBorisBTIS3>( params, species );
                 }
             } else if (species->pusher_name_ == "ponderomotive_borisBTIS3"){
                 if (!params.use_BTIS3){
@@ -97,7 +112,7 @@ public:
         // Photon
         else if( species->mass_ == 0 ) {
             if( species->pusher_name_ == "norm" ) {
-                Push = new PusherPhoton( params, species );
+                Push = createForDimension<PusherPhoton>( params, species );
             } else {
                 ERROR_NAMELIST( "For photon species " << species->name_
                        << ": unknown pusher `"
@@ -136,7 +151,7 @@ public:
         if( species->mass_ > 0 ) {
             // assign the correct Pusher to Push_ponderomotive_position
             if( (species->pusher_name_ == "ponderomotive_boris") || (species->pusher_name_ == "ponderomotive_borisBTIS3") ) {
-                    Push_ponderomotive_position = new PusherPonderomotivePositionBoris( params, species );
+                    Push_ponderomotive_position = createForDimension<PusherPonderomotivePositionBoris>( params, species );
             }
             
             else {
@@ -16,12 +16,14 @@
 
 #include "Particles.h"
 
-PusherHigueraCary::PusherHigueraCary( Params &params, Species *species )
+template <int nDim>
+PusherHigueraCary<nDim>::PusherHigueraCary( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherHigueraCary::~PusherHigueraCary()
+template <int nDim>
+PusherHigueraCary<nDim>::~PusherHigueraCary()
 {
 }
 
@@ -29,7 +31,8 @@ PusherHigueraCary::~PusherHigueraCary()
   Lorentz Force -- leap-frog (HigueraCary) scheme
  ***********************************************************************/
 
-void PusherHigueraCary::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherHigueraCary<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
 {
     std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
     std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
@@ -45,8 +48,8 @@ void PusherHigueraCary::operator()( Particles &particles, SmileiMPI *smpi, int i
     double * __restrict__ invgf = &( smpi->dynamics_invgf[ithread][0] );
 
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
     
     double *const __restrict__ momentum_x = particles.getPtrMomentum(0);
     double *const __restrict__ momentum_y = particles.getPtrMomentum(1);
@@ -157,9 +160,9 @@ void PusherHigueraCary::operator()( Particles &particles, SmileiMPI *smpi, int i
         // Move the particle
         // local_invgf *= dt;
         position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart2];
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart2];
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart2];
             }
         }
@@ -196,3 +199,8 @@ void PusherHigueraCary::operator()( Particles &particles, SmileiMPI *smpi, int i
     // }
 
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherHigueraCary<1>;
+template class PusherHigueraCary<2>;
+template class PusherHigueraCary<3>;
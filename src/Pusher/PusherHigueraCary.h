@@ -14,7 +14,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherHigueraCary
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherHigueraCary : public Pusher
 {
 public:
@@ -14,12 +14,14 @@
 #include "Species.h"
 #include "Particles.h"
 
-PusherPhoton::PusherPhoton( Params &params, Species *species )
+template <int nDim>
+PusherPhoton<nDim>::PusherPhoton( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherPhoton::~PusherPhoton()
+template <int nDim>
+PusherPhoton<nDim>::~PusherPhoton()
 {
 }
 
@@ -27,15 +29,16 @@ PusherPhoton::~PusherPhoton()
     Rectilinear propagation of the photons
 ***********************************************************************/
 
-void PusherPhoton::operator()( Particles &particles, SmileiMPI *smpi,
+template <int nDim>
+void PusherPhoton<nDim>::operator()( Particles &particles, SmileiMPI *smpi,
                                int istart, int iend, int ithread, int ipart_ref )
 {
     // Inverse normalized energy
     double * __restrict__ invgf = &( smpi->dynamics_invgf[ithread][0] );
 
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
     
     const double *const __restrict__ momentum_x = particles.getPtrMomentum(0);
     const double *const __restrict__ momentum_y = particles.getPtrMomentum(1);
@@ -76,9 +79,9 @@ void PusherPhoton::operator()( Particles &particles, SmileiMPI *smpi,
 
         // Move the photons
         position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart];
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart];
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart];
             }
         }
@@ -102,3 +105,8 @@ void PusherPhoton::operator()( Particles &particles, SmileiMPI *smpi,
     //}
 
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherPhoton<1>;
+template class PusherPhoton<2>;
+template class PusherPhoton<3>;
@@ -16,7 +16,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherPhoton
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherPhoton : public Pusher
 {
 public:
@@ -8,12 +8,14 @@
 #include "Particles.h"
 
 // Pushes only position of particles interacting with envelope, not their momentum
-PusherPonderomotivePositionBoris::PusherPonderomotivePositionBoris( Params &params, Species *species )
+template <int nDim>
+PusherPonderomotivePositionBoris<nDim>::PusherPonderomotivePositionBoris( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherPonderomotivePositionBoris::~PusherPonderomotivePositionBoris()
+template <int nDim>
+PusherPonderomotivePositionBoris<nDim>::~PusherPonderomotivePositionBoris()
 {
 }
 
@@ -21,7 +23,8 @@ PusherPonderomotivePositionBoris::~PusherPonderomotivePositionBoris()
     Lorentz Force + Ponderomotive force -- leap-frog (Boris-style) scheme, position advance
 **************************************************************************/
 
-void PusherPonderomotivePositionBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherPonderomotivePositionBoris<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
 {
 
     std::vector<double> *Phi_mpart     = &( smpi->dynamics_PHI_mpart[ithread] );
@@ -38,8 +41,8 @@ void PusherPonderomotivePositionBoris::operator()( Particles &particles, SmileiM
     double *const __restrict__ momentum_z = particles.getPtrMomentum(2);
     
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
     
     const short *const charge = particles.getPtrCharge( ) ;
     
@@ -80,12 +83,17 @@ void PusherPonderomotivePositionBoris::operator()( Particles &particles, SmileiM
         
         // Move the particle
         position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart-ipart_buffer_offset];
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart-ipart_buffer_offset];
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart-ipart_buffer_offset];
             }
         }
         
     } // end loop on particles
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherPonderomotivePositionBoris<1>;
+template class PusherPonderomotivePositionBoris<2>;
+template class PusherPonderomotivePositionBoris<3>;
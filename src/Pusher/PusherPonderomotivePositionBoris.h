@@ -12,7 +12,10 @@ generic class for the particle pusher of Boris adapted for envelope model. Only
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherPonderomotiveBoris, only pushes momentum of particles interacting with envelope, not their position
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherPonderomotivePositionBoris : public Pusher
 {
 public:
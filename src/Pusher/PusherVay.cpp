@@ -16,12 +16,14 @@
 
 #include "Particles.h"
 
-PusherVay::PusherVay( Params &params, Species *species )
+template <int nDim>
+PusherVay<nDim>::PusherVay( Params &params, Species *species )
     : Pusher( params, species )
 {
 }
 
-PusherVay::~PusherVay()
+template <int nDim>
+PusherVay<nDim>::~PusherVay()
 {
 }
 
@@ -29,15 +31,31 @@ PusherVay::~PusherVay()
     Lorentz Force -- leap-frog (Vay) scheme
 ***********************************************************************/
 
-void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+template <int nDim>
+void PusherVay<nDim>::operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset )
+{
+#if !defined( SMILEI_ACCELERATOR_GPU )
+    if( mixed_precision_ ) {
+        pushParticles( particles, smpi, istart, iend, ithread, ipart_buffer_offset,
+                       smpi->dynamics_Epart_float[ithread].data(), smpi->dynamics_Bpart_float[ithread].data() );
+        return;
+    }
+#endif
+    pushParticles( particles, smpi, istart, iend, ithread, ipart_buffer_offset,
+                   smpi->dynamics_Epart[ithread].data(), smpi->dynamics_Bpart[ithread].data() );
+}
+
+//! Push with the interpolated fields read from Epart_buffer and Bpart_buffer (double, or float for mixed precision)
+template <int nDim>
+template<typename field_t>
+void PusherVay<nDim>::pushParticles( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                               const field_t *Epart_buffer, const field_t *Bpart_buffer )
 {
-    std::vector<double> *Epart = &( smpi->dynamics_Epart[ithread] );
-    std::vector<double> *Bpart = &( smpi->dynamics_Bpart[ithread] );
     double *const invgf = &( smpi->dynamics_invgf[ithread][0] );
 
     double *const __restrict__ position_x = particles.getPtrPosition( 0 );
-    double *const __restrict__ position_y = nDim_ > 1 ? particles.getPtrPosition( 1 ) : nullptr;
-    double *const __restrict__ position_z = nDim_ > 2 ? particles.getPtrPosition( 2 ) : nullptr;
+    double *const __restrict__ position_y = nDim > 1 ? particles.getPtrPosition( 1 ) : nullptr;
+    double *const __restrict__ position_z = nDim > 2 ? particles.getPtrPosition( 2 ) : nullptr;
     
     double *const __restrict__ momentum_x = particles.getPtrMomentum(0);
     double *const __restrict__ momentum_y = particles.getPtrMomentum(1);
@@ -46,12 +64,12 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
     const short *const charge = particles.getPtrCharge();
 
     const int nparts = smpi->getBufferSize(ithread);
-    const double *const __restrict__ Ex = &( ( *Epart )[0*nparts] );
-    const double *const __restrict__ Ey = &( ( *Epart )[1*nparts] );
-    const double *const __restrict__ Ez = &( ( *Epart )[2*nparts] );
-    const double *const __restrict__ Bx = &( ( *Bpart )[0*nparts] );
-    const double *const __restrict__ By = &( ( *Bpart )[1*nparts] );
-    const double *const __restrict__ Bz = &( ( *Bpart )[2*nparts] );
+    const field_t *const __restrict__ Ex = &( Epart_buffer[0*nparts] );
+    const field_t *const __restrict__ Ey = &( Epart_buffer[1*nparts] );
+    const field_t *const __restrict__ Ez = &( Epart_buffer[2*nparts] );
+    const field_t *const __restrict__ Bx = &( Bpart_buffer[0*nparts] );
+    const field_t *const __restrict__ By = &( Bpart_buffer[1*nparts] );
+    const field_t *const __restrict__ Bz = &( Bpart_buffer[2*nparts] );
     
 #if defined( SMILEI_ACCELERATOR_GPU_OMP )
     const int istart_offset   = istart - ipart_buffer_offset;
@@ -163,9 +181,9 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
 
         // Move the particle
         position_x[ipart] += dt*momentum_x[ipart]*invgf[ipart-ipart_buffer_offset];
-        if (nDim_>1) {
+        if (nDim > 1) {
             position_y[ipart] += dt*momentum_y[ipart]*invgf[ipart-ipart_buffer_offset];
-            if (nDim_>2) {
+            if (nDim > 2) {
                 position_z[ipart] += dt*momentum_z[ipart]*invgf[ipart-ipart_buffer_offset];
             }
         }
@@ -201,3 +219,8 @@ void PusherVay::operator()( Particles &particles, SmileiMPI *smpi, int istart, i
     // }
 
 }
+
+// Explicit instantiations for the dimensions of the particle positions
+template class PusherVay<1>;
+template class PusherVay<2>;
+template class PusherVay<3>;
@@ -15,7 +15,10 @@
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class PusherVay
+//! nDim is the number of dimensions of the particle positions (1, 2 or 3),
+//! so that the push loop does not branch on the dimension
 //  --------------------------------------------------------------------------------------------------------------------
+template <int nDim>
 class PusherVay : public Pusher
 {
 public:
@@ -24,7 +27,12 @@ public:
     ~PusherVay();
     //! Overloading of () operator
     virtual void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset = 0 );
-    
+
+private:
+    //! Push kernel, templated on the precision of the interpolated fields
+    template<typename field_t>
+    void pushParticles( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset,
+                        const field_t *Epart_buffer, const field_t *Bpart_buffer );
 };
 
 #endif
@@ -14,7 +14,9 @@ def _mkdir(role, path):
         try:
             os.makedirs(path)
         except:
-            raise Exception("ERROR in the namelist: "+role+" "+path+" cannot be created")
+            # another process of the same node may have created it meanwhile
+            if not os.path.isdir(path):
+                raise Exception("ERROR in the namelist: "+role+" "+path+" cannot be created")
     elif not os.path.isdir(path):
         raise Exception("ERROR in the namelist: "+role+" "+path+" exists but is not a directory")
 
@@ -30,6 +32,14 @@ def _prepare_checkpoint_dir():
                 _mkdir("checkpoint", group_dir)
         else:
             _mkdir("checkpoint", checkpoint_dir)
+    # Node-local checkpoint dir: each process prepares its own
+    if Checkpoints.local_dump_dir and (Checkpoints.dump_step>0 or Checkpoints.dump_minutes>0.):
+        local_dir = Checkpoints.local_dump_dir + os.sep + "checkpoints" + os.sep
+        if Checkpoints.file_grouping:
+            ngroups = int((smilei_mpi_size-1)/Checkpoints.file_grouping + 1)
+            ngroups_chars = int(math.log10(ngroups))+1
+            local_dir += '%0*d'%(ngroups_chars,int(smilei_mpi_rank/Checkpoints.file_grouping))
+        _mkdir("local checkpoint", local_dir)
 
 def _smilei_check():
     """Do checks over the script"""
@@ -57,7 +67,20 @@ def _smilei_check():
                 pattern += "*"+ os.sep
             pattern += "dump-*-*.h5"
             # pick those file that match the mpi rank
-            files = filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(pattern))
+            files = list(filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(pattern)))
+            # node-local copies are put first, so that they are preferred to the same dumps in restart_dir
+            if Checkpoints.local_dump_dir:
+                local_pattern = Checkpoints.local_dump_dir + os.sep + "checkpoints" + os.sep
+                if Checkpoints.file_grouping:
+                    local_pattern += "*"+ os.sep
+                local_pattern += "dump-*-*.h5"
+                files = list(filter(lambda a: smilei_mpi_rank==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(local_pattern))) + files
+            # processes absent from the dumped simulation read the general data in the files of the rank 0
+            # (their patches are read from the files of the processes that dumped them).
+            # The number of dumped processes is only known from the files: Checkpoint checks that this
+            # process is really absent from the dumped simulation, otherwise its files are missing.
+            if len(files) == 0:
+                files = list(filter(lambda a: 0==int(search(r'dump-[0-9]*-([0-9]*).h5$',a).groups()[-1]), glob(pattern)))
             
             if Checkpoints.restart_number is not None:
                 # pick those file that match the restart_number
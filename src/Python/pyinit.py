@@ -198,6 +198,18 @@ class Main(SmileiSingleton):
 
     # Default fields
     maxwell_solver = 'Yee'
+    maxwell_tile_size = 0
+    maxwell_temporal_blocking = False
+    maxwell_overlap_communications = False
+    fused_field_loops = False
+    persistent_communications = False
+    aggregate_communications = False
+    shared_memory_communications = False
+    float_sums = False
+    float_sums_tolerance = 1e-6
+    pipelined_particle_exchange = False
+    packed_particle_exchange = False
+    direct_particle_exchange = False
     EM_boundary_conditions = [["periodic"]]
     EM_boundary_conditions_k = []
     save_magnectic_fields_for_SM = True
@@ -344,6 +356,10 @@ class Vectorization(SmileiSingleton):
     mode                = "off"
     reconfigure_every   = 20
     initial_mode        = "off"
+    fused_dynamics      = False
+    fused_chunk_size    = 64
+    full_sort_threshold = 0.3
+    cell_ordering       = "row_major"
 
 
 class MovingWindow(SmileiSingleton):
@@ -364,7 +380,11 @@ class Checkpoints(SmileiSingleton):
     dump_minutes = 0.
     keep_n_dumps = 2
     dump_deflate = 0
+    dump_compression = None
     exit_after_dump = True
+    async_dump = False
+    incremental_dump = False
+    local_dump_dir = None
     file_grouping = 0
     restart_files = []
 
@@ -435,6 +455,7 @@ class Species(SmileiComponent):
     is_test = False
     relativistic_field_initialization = False
     keep_interpolated_fields = []
+    mixed_precision = False
 
 class ParticleInjector(SmileiComponent):
     """Parameters for particle injection at boundaries"""
@@ -564,6 +585,8 @@ class DiagFields(SmileiComponent):
     subgrid = None
     flush_every = 1
     datatype = "double"
+    compression = None
+    compression_level = 0
 
 class DiagTrackParticles(SmileiComponent):
     """Track diagnostic"""
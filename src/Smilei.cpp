@@ -533,11 +533,19 @@ int main( int argc, char *argv[] )
             // apply currents from antennas
             vecPatches.applyAntennas( time_dual );
 
+            // with fused field loops, Maxwell's equations are solved without leaving the parallel region
+            if( params.fused_field_loops && !params.multiple_decomposition && time_dual > params.time_fields_frozen ) {
+                if ( vecPatches(0)->EMfields->prescribedFields.size() ) {
+                    vecPatches.resetPrescribedFields();
+                }
+                vecPatches.solveMaxwell( params, simWindow, itime, time_dual, timers, &smpi );
+            }
+
         } //End omp parallel region
 
         // solve Maxwell's equations
         if (!params.multiple_decomposition) {
-            if( time_dual > params.time_fields_frozen ) {
+            if( time_dual > params.time_fields_frozen && !params.fused_field_loops ) {
                 #pragma omp parallel shared (time_dual,smpi,params, vecPatches, region, simWindow, checkpoint, itime)
                 {
                     // de-apply prescribed fields if requested
@@ -748,6 +756,9 @@ int main( int argc, char *argv[] )
     
     }//END of the time loop
 
+    // Checkpoint files written in the background must be complete before exiting
+    checkpoint.waitDump();
+
     smpi.barrier();
 
     // ------------------------------------------------------------------
@@ -759,6 +770,9 @@ int main( int argc, char *argv[] )
     TITLE( "Time profiling : (print time > 0.001%)" );
     timers.profile( &smpi );
 
+    TITLE( "Peak memory of the particle dynamics buffers (per thread)" );
+    smpi.printDynamicsBuffersMemory();
+
     smpi.barrier();
 
     /*tommaso
@@ -3,7 +3,10 @@
 #include "ParticlesFactory.h"
 #include "Field.h"
 #include "Patch.h"
+#include "SmileiMPI.h"
 
+#include <cmath>
+#include <cstring>
 #include <vector>
 using namespace std;
 
@@ -12,8 +15,47 @@ AsyncMPIbuffers::AsyncMPIbuffers()
 }
 
 
+AsyncMPIbuffers::AsyncMPIbuffers( const AsyncMPIbuffers &other )
+{
+    copyBuffers( other );
+}
+
+
+AsyncMPIbuffers &AsyncMPIbuffers::operator=( const AsyncMPIbuffers &other )
+{
+    if( this != &other ) {
+        freePersistentRequests();
+        copyBuffers( other );
+    }
+    return *this;
+}
+
+
 AsyncMPIbuffers::~AsyncMPIbuffers()
 {
+    freePersistentRequests();
+}
+
+
+void AsyncMPIbuffers::copyBuffers( const AsyncMPIbuffers &other )
+{
+    float_sums = other.float_sums;
+    srequest = other.srequest;
+    rrequest = other.rrequest;
+    for( unsigned int iDim=0 ; iDim<srequest.size() ; iDim++ ) {
+        srequest[iDim].assign( srequest[iDim].size(), MPI_REQUEST_NULL );
+        rrequest[iDim].assign( rrequest[iDim].size(), MPI_REQUEST_NULL );
+    }
+    for( int iDim=0 ; iDim<3 ; iDim++ ) {
+        for( int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+            buf[iDim][iNeighbor] = other.buf[iDim][iNeighbor];
+            ibuf[iDim][iNeighbor] = other.ibuf[iDim][iNeighbor];
+            float_send_buf[iDim][iNeighbor] = other.float_send_buf[iDim][iNeighbor];
+            float_recv_buf[iDim][iNeighbor] = other.float_recv_buf[iDim][iNeighbor];
+        }
+    }
+    send_tags_ = other.send_tags_;
+    recv_tags_ = other.recv_tags_;
 }
 
 
@@ -60,6 +102,128 @@ void AsyncMPIbuffers::defineTags( Patch *patch, SmileiMPI *smpi, int tag )
 }
 
 
+void AsyncMPIbuffers::isend( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, bool persistent )
+{
+    if( persistent ) {
+        startPersistent( persistent_send_, srequest[iDim][iNeighbor], true, buffer, count, rank, tag, iDim, iNeighbor );
+    } else {
+        MPI_Isend( buffer, count, MPI_DOUBLE, rank, tag, MPI_COMM_WORLD, &( srequest[iDim][iNeighbor] ) );
+    }
+}
+
+void AsyncMPIbuffers::irecv( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, bool persistent )
+{
+    if( persistent ) {
+        startPersistent( persistent_recv_, rrequest[iDim][iNeighbor], false, buffer, count, rank, tag, iDim, iNeighbor );
+    } else {
+        MPI_Irecv( buffer, count, MPI_DOUBLE, rank, tag, MPI_COMM_WORLD, &( rrequest[iDim][iNeighbor] ) );
+    }
+}
+
+void AsyncMPIbuffers::isendSum( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, SmileiMPI *smpi )
+{
+    // Rounding error of the message in single precision
+    std::vector<float> &float_buffer = float_send_buf[iDim][iNeighbor];
+    float_buffer.resize( count );
+    double error2 = 0., norm2 = 0.;
+    for( int i=0 ; i<count ; i++ ) {
+        float_buffer[i] = buffer[i];
+        double error = buffer[i] - ( double )float_buffer[i];
+        error2 += error*error;
+        norm2  += buffer[i]*buffer[i];
+    }
+    
+    // The receiver tells the precision from the size of the message
+    bool single = error2 <= smpi->float_sums_tolerance*smpi->float_sums_tolerance*norm2 && std::isfinite( error2 );
+    if( single ) {
+        MPI_Isend( &float_buffer[0], count*sizeof( float ), MPI_BYTE, rank, tag, MPI_COMM_WORLD, &( srequest[iDim][iNeighbor] ) );
+    } else {
+        MPI_Isend( buffer, count*sizeof( double ), MPI_BYTE, rank, tag, MPI_COMM_WORLD, &( srequest[iDim][iNeighbor] ) );
+    }
+    
+    smpi->accumulateFloatSumsError( single ? error2 : 0., single ? norm2 : 0., !single );
+}
+
+void AsyncMPIbuffers::irecvSum( int count, int rank, int tag, int iDim, int iNeighbor )
+{
+    std::vector<double> &recv_buffer = float_recv_buf[iDim][iNeighbor];
+    recv_buffer.resize( count );
+    MPI_Irecv( &recv_buffer[0], count*sizeof( double ), MPI_BYTE, rank, tag, MPI_COMM_WORLD, &( rrequest[iDim][iNeighbor] ) );
+}
+
+void AsyncMPIbuffers::waitSum( double *buffer, int count, int iDim, int iNeighbor )
+{
+    MPI_Status status;
+    MPI_Wait( &( rrequest[iDim][iNeighbor] ), &status );
+    int nbytes;
+    MPI_Get_count( &status, MPI_BYTE, &nbytes );
+    
+    std::vector<double> &recv_buffer = float_recv_buf[iDim][iNeighbor];
+    if( nbytes == count*( int )sizeof( double ) ) {
+        memcpy( buffer, &recv_buffer[0], count*sizeof( double ) );
+    } else {
+        const float *float_buffer = reinterpret_cast<const float *>( &recv_buffer[0] );
+        for( int i=0 ; i<count ; i++ ) {
+            buffer[i] = float_buffer[i];
+        }
+    }
+}
+
+void AsyncMPIbuffers::startPersistent( std::vector< std::vector<PersistentRequest> > &persistent, MPI_Request &request, bool send,
+                                       double *buffer, int count, int rank, int tag, int iDim, int iNeighbor )
+{
+    if( persistent.size() != srequest.size() ) {
+        PersistentRequest none = { MPI_REQUEST_NULL, NULL, 0, MPI_PROC_NULL, 0 };
+        persistent.assign( srequest.size(), vector<PersistentRequest>( 2, none ) );
+    }
+    
+    PersistentRequest &p = persistent[iDim][iNeighbor];
+    if( p.request == MPI_REQUEST_NULL || p.buffer != buffer || p.count != count || p.rank != rank || p.tag != tag ) {
+        if( p.request != MPI_REQUEST_NULL ) {
+            MPI_Request_free( &p.request );
+        }
+        if( send ) {
+            MPI_Send_init( buffer, count, MPI_DOUBLE, rank, tag, MPI_COMM_WORLD, &p.request );
+        } else {
+            MPI_Recv_init( buffer, count, MPI_DOUBLE, rank, tag, MPI_COMM_WORLD, &p.request );
+        }
+        p.buffer = buffer;
+        p.count  = count;
+        p.rank   = rank;
+        p.tag    = tag;
+    }
+    
+    MPI_Start( &p.request );
+    // MPI_Wait on this copy leaves the persistent request inactive, not freed
+    request = p.request;
+}
+
+void AsyncMPIbuffers::freePersistentRequests()
+{
+    int finalized( 0 );
+    MPI_Finalized( &finalized );
+    if( finalized ) {
+        return;
+    }
+    for( size_t i=0 ; i<persistent_send_.size() ; i++ ) {
+        for( size_t j=0 ; j<persistent_send_[i].size() ; j++ ) {
+            if( persistent_send_[i][j].request != MPI_REQUEST_NULL ) {
+                MPI_Request_free( &persistent_send_[i][j].request );
+            }
+        }
+    }
+    for( size_t i=0 ; i<persistent_recv_.size() ; i++ ) {
+        for( size_t j=0 ; j<persistent_recv_[i].size() ; j++ ) {
+            if( persistent_recv_[i][j].request != MPI_REQUEST_NULL ) {
+                MPI_Request_free( &persistent_recv_[i][j].request );
+            }
+        }
+    }
+    persistent_send_.clear();
+    persistent_recv_.clear();
+}
+
+
 SpeciesMPIbuffers::SpeciesMPIbuffers()
 {
 }
@@ -73,6 +237,10 @@ SpeciesMPIbuffers::~SpeciesMPIbuffers()
         delete partSend[i][0];
         delete partSend[i][1];
     }
+    for( size_t k=0 ; k<cornerSend.size() ; k++ ) {
+        delete cornerSend[k];
+        delete cornerRecv[k];
+    }
 }
 
 
@@ -109,5 +277,61 @@ void SpeciesMPIbuffers::allocate( Params &params, Patch *patch )
             partSend[i][1] = new Particles();
         }
     }
+    
+    if( params.direct_particle_exchange ) {
+        int nNeighbors = 1;
+        for( unsigned int i=0 ; i<params.nDim_field ; i++ ) {
+            nNeighbors *= 3;
+        }
+        
+        cornerSend.assign( nNeighbors, NULL );
+        cornerRecv.assign( nNeighbors, NULL );
+        directSendSize.assign( nNeighbors, 0 );
+        directRecvSize.assign( nNeighbors, 0 );
+        directSrequest.assign( nNeighbors, MPI_REQUEST_NULL );
+        directRrequest.assign( nNeighbors, MPI_REQUEST_NULL );
+        directTypeSend.assign( nNeighbors, MPI_DATATYPE_NULL );
+        directTypeRecv.assign( nNeighbors, MPI_DATATYPE_NULL );
+        directPackedSend.resize( nNeighbors );
+        directPackedRecv.resize( nNeighbors );
+        direct_face_dim_.assign( nNeighbors, -1 );
+        direct_face_side_.assign( nNeighbors, -1 );
+        
+        for( int k=0 ; k<nNeighbors ; k++ ) {
+            // Offsets (-1, 0 or 1) of the neighbor k along each dimension
+            int nonzero = 0, stride = 1;
+            for( unsigned int i=0 ; i<params.nDim_field ; i++ ) {
+                int offset = ( k/stride )%3 - 1;
+                if( offset != 0 ) {
+                    nonzero++;
+                    direct_face_dim_[k]  = i;
+                    direct_face_side_[k] = ( offset+1 )/2;
+                }
+                stride *= 3;
+            }
+            if( nonzero > 1 ) {
+                direct_face_dim_[k]  = -1;
+                direct_face_side_[k] = -1;
+                cornerSend[k] = new Particles();
+                cornerRecv[k] = new Particles();
+            }
+        }
+    }
+}
+
+
+Particles *&SpeciesMPIbuffers::directSend( int k )
+{
+    if( direct_face_dim_[k] >= 0 ) {
+        return partSend[direct_face_dim_[k]][direct_face_side_[k]];
+    }
+    return cornerSend[k];
 }
 
+Particles *&SpeciesMPIbuffers::directRecv( int k )
+{
+    if( direct_face_dim_[k] >= 0 ) {
+        return partRecv[direct_face_dim_[k]][direct_face_side_[k]];
+    }
+    return cornerRecv[k];
+}
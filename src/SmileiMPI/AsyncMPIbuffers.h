@@ -17,19 +17,65 @@ public:
     AsyncMPIbuffers();
     ~AsyncMPIbuffers();
     
+    //! The copy (a copied Field) has no request in flight and no persistent request: sharing the persistent
+    //! requests would free them in both destructors
+    AsyncMPIbuffers( const AsyncMPIbuffers &other );
+    AsyncMPIbuffers &operator=( const AsyncMPIbuffers &other );
+    
     void allocate( unsigned int nDim_field );
     
     void defineTags( Patch *patch, SmileiMPI *smpi, int tag ) ;
     
+    //! Posts the send of count doubles to the neighbor iNeighbor in the direction iDim (request in srequest)
+    //! If persistent, the request is created once with MPI_Send_init and restarted with MPI_Start
+    void isend( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, bool persistent );
+    //! Same as isend for a reception (request in rrequest)
+    void irecv( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, bool persistent );
+    
+    //! Posts the send of count doubles to sum (Main.float_sums): in single precision, unless the relative
+    //! rounding error of the message exceeds the tolerance (the rounding errors are accumulated in smpi)
+    void isendSum( double *buffer, int count, int rank, int tag, int iDim, int iNeighbor, SmileiMPI *smpi );
+    //! Posts the reception of count doubles to sum, sent by isendSum in single or double precision
+    void irecvSum( int count, int rank, int tag, int iDim, int iNeighbor );
+    //! Waits for the reception posted by irecvSum and writes the count doubles received in buffer
+    void waitSum( double *buffer, int count, int iDim, int iNeighbor );
+    
+    //! The sums of this field are sent with isendSum (Jx, Jy, Jz and Rho with Main.float_sums)
+    bool float_sums = false;
+    
     //! ndim vectors of 2 sent requests (1 per direction)
     std::vector< std::vector<MPI_Request> > srequest;
     //! ndim vectors of 2 received requests (1 per direction)
     std::vector< std::vector<MPI_Request> > rrequest;
     std::vector< double >  buf[3][2];
     std::vector< std::complex<double> >  ibuf[3][2];
+    //! Single precision values sent, and values received in single or double precision (float_sums)
+    std::vector< float >  float_send_buf[3][2];
+    std::vector< double > float_recv_buf[3][2];
     
     std::vector< std::vector<int> > send_tags_, recv_tags_;
     
+private:
+    //! Persistent request and the arguments it was created with
+    struct PersistentRequest {
+        MPI_Request request;
+        double *buffer;
+        int count, rank, tag;
+    };
+    
+    //! ndim vectors of 2 persistent requests (1 per direction), created at the first exchange
+    std::vector< std::vector<PersistentRequest> > persistent_send_, persistent_recv_;
+    
+    //! Starts the persistent request of (iDim,iNeighbor), created again if its arguments changed
+    //! (buffer reallocated, new neighbor or tag after a load balancing or a move of the window)
+    void startPersistent( std::vector< std::vector<PersistentRequest> > &persistent, MPI_Request &request, bool send,
+                          double *buffer, int count, int rank, int tag, int iDim, int iNeighbor );
+    
+    void freePersistentRequests();
+    
+    //! Copies the buffers and the tags of other, with null requests
+    void copyBuffers( const AsyncMPIbuffers &other );
+    
 };
 
 class SpeciesMPIbuffers : public AsyncMPIbuffers
@@ -50,6 +96,33 @@ public:
     //! ndim vectors of 2 numbers of particles to receive (1 per direction)
     std::vector< std::vector< unsigned int > > partRecvSize;
     
+    //! Packed particles sent and received (1 per direction, see Particles::pack)
+    std::vector< char > packedSend[3][2];
+    std::vector< char > packedRecv[3][2];
+    
+    // Direct exchange with all the neighbors (Main.direct_particle_exchange)
+    // The 3^ndim neighbors are indexed as in Patch::direct_neighbor_
+    
+    //! Buffer of particles sent to the direct neighbor k (partSend of the face for the face neighbors)
+    Particles *&directSend( int k );
+    //! Buffer of particles received from the direct neighbor k (partRecv of the face for the face neighbors)
+    Particles *&directRecv( int k );
+    
+    //! Particles sent to and received from the corner neighbors (NULL for the faces and the patch itself)
+    std::vector< Particles * > cornerSend, cornerRecv;
+    //! Numbers of particles to send and to receive, per direct neighbor
+    std::vector< unsigned int > directSendSize, directRecvSize;
+    //! Requests of the direct exchange, per direct neighbor
+    std::vector< MPI_Request > directSrequest, directRrequest;
+    //! MPI types of the particles sent and received, per direct neighbor
+    std::vector< MPI_Datatype > directTypeSend, directTypeRecv;
+    //! Packed particles sent and received, per direct neighbor
+    std::vector< std::vector< char > > directPackedSend, directPackedRecv;
+    
+private:
+    //! Dimension and side of the face of each direct neighbor (-1 for the corners and the patch itself)
+    std::vector< int > direct_face_dim_, direct_face_side_;
+    
 };
 
 #endif
@@ -0,0 +1,415 @@
+
+#include "HaloMessages.h"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+
+#include "Field.h"
+#include "cField.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+#include "SmileiMPI.h"
+
+using namespace std;
+
+HaloMessages::~HaloMessages()
+{
+    int finalized( 0 );
+    MPI_Finalized( &finalized );
+    if( finalized ) {
+        return;
+    }
+    for( map<string, Exchange>::iterator it = exchanges_.begin() ; it != exchanges_.end() ; it++ ) {
+        freeShared( it->second );
+    }
+}
+
+void HaloMessages::post( const string &name, const vector<Field *> &fields, const vector<int> &patches,
+                         int iDim, VectorPatch &vecPatches, SmileiMPI *smpi )
+{
+    map<string, Exchange>::iterator it = exchanges_.find( name );
+    if( it == exchanges_.end() ) {
+        Exchange exchange;
+        // Tags assigned in the order of the first exchanges, so that two exchanges never have the same tag. This order
+        // is the same on all the processes (the exchanges are posted by all of them): checked once per name
+        unsigned int hash = 0;
+        for( unsigned int i=0 ; i<name.size() ; i++ ) {
+            hash = 31*hash + ( unsigned char )name[i];
+        }
+        long hashes[2] = { ( long )hash, -( long )hash };
+        MPI_Allreduce( MPI_IN_PLACE, hashes, 2, MPI_LONG, MPI_MAX, smpi->halo_comm );
+        if( hashes[0] != ( long )hash || -hashes[1] != ( long )hash ) {
+            ERROR( "Halo exchange `" << name << "` is not the same on all the processes" );
+        }
+        if( 8*( exchanges_.size()+1 ) > 32767 ) {
+            ERROR( "Too many halo exchanges for the MPI tags" );
+        }
+        exchange.tag = 8*exchanges_.size();
+        exchange.nsend = 0;
+        exchange.nrecv = 0;
+        exchange.node_comm = smpi->shared_memory_communications ? smpi->node_comm : MPI_COMM_NULL;
+        exchange.node_me = -1;
+        exchange.window = MPI_WIN_NULL;
+        exchange.segment = NULL;
+        exchange.capacity = 0;
+        exchange.header_size = 0;
+        exchange.used = 0;
+        exchange.nshared = 0;
+        exchange.sequence = 0;
+        exchange.comm = smpi->halo_comm;
+        if( exchange.node_comm != MPI_COMM_NULL ) {
+            // Header: sequence number, number of messages, sequence number read in each segment of the node, then
+            // (node rank of the receiver, iDim, side, offset, size) per message, at most one message per direction
+            // and side for each process of the node
+            int node_size;
+            MPI_Comm_rank( exchange.node_comm, &exchange.node_me );
+            MPI_Comm_size( exchange.node_comm, &node_size );
+            exchange.header_size = 2 + node_size + 5*6*node_size;
+        }
+        it = exchanges_.insert( make_pair( name, exchange ) ).first;
+    }
+    Exchange &exchange = it->second;
+
+    // The segment is overwritten by the first direction of the exchange
+    if( exchange.nsend == 0 && exchange.window != MPI_WIN_NULL ) {
+        waitReaders( exchange );
+    }
+
+    // Messages of the direction iDim
+    const unsigned int first_send = exchange.nsend;
+    const unsigned int first_recv = exchange.nrecv;
+    const unsigned int npatches = patches.size();
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        Patch *patch = vecPatches( patches[ifield%npatches] );
+        SubField sub_field;
+        sub_field.icomp = ifield/npatches;
+        for( int side=0 ; side<2 ; side++ ) {
+            if( !patch->is_a_MPI_neighbor( iDim, side ) ) {
+                continue;
+            }
+            sub_field.hindex = patch->hindex;
+            sub_field.field = fields[ifield]->sendFields_[iDim*2+side];
+            message( exchange.send, exchange.nsend, patch->MPI_neighbor_[iDim][side], iDim, side ).sub_fields.push_back( sub_field );
+            sub_field.hindex = patch->neighbor_[iDim][side];
+            sub_field.field = fields[ifield]->recvFields_[iDim*2+side];
+            message( exchange.recv, exchange.nrecv, patch->MPI_neighbor_[iDim][side], iDim, side ).sub_fields.push_back( sub_field );
+        }
+    }
+
+    for( unsigned int imsg=first_recv ; imsg<exchange.nrecv ; imsg++ ) {
+        Message &msg = exchange.recv[imsg];
+        sort( msg.sub_fields.begin(), msg.sub_fields.end(), before );
+        if( exchange.node_comm != MPI_COMM_NULL ) {
+            msg.node_rank = smpi->node_rank[msg.rank];
+            if( msg.node_rank >= 0 ) {
+                // Read in the segment of the neighbor (see readShared)
+                continue;
+            }
+        }
+        unsigned int size = HaloMessages::size( msg );
+        msg.buffer.resize( size );
+        // Sent from the opposite side of the neighbor
+        MPI_Irecv( &msg.buffer[0], size, MPI_DOUBLE, msg.rank, exchange.tag + msg.iDim*2 + ( msg.side+1 )%2,
+                   smpi->halo_comm, &msg.request );
+    }
+
+    for( unsigned int imsg=first_send ; imsg<exchange.nsend ; imsg++ ) {
+        Message &msg = exchange.send[imsg];
+        sort( msg.sub_fields.begin(), msg.sub_fields.end(), before );
+        if( exchange.node_comm != MPI_COMM_NULL ) {
+            msg.node_rank = smpi->node_rank[msg.rank];
+            // Before the allocation of the window, packed in readShared
+            if( msg.node_rank >= 0 && ( exchange.window == MPI_WIN_NULL || packShared( exchange, msg ) ) ) {
+                continue;
+            }
+        }
+        sendMPI( exchange, msg );
+    }
+}
+
+void HaloMessages::wait( const string &name )
+{
+    Exchange &exchange = exchanges_[name];
+
+    if( exchange.node_comm != MPI_COMM_NULL ) {
+        readShared( exchange );
+    }
+
+    for( unsigned int imsg=0 ; imsg<exchange.nrecv ; imsg++ ) {
+        Message &msg = exchange.recv[imsg];
+        if( msg.node_rank >= 0 ) {
+            continue;
+        }
+        MPI_Status status;
+        MPI_Wait( &msg.request, &status );
+        const double *buffer = msg.buffer.data();
+        for( unsigned int i=0 ; i<msg.sub_fields.size() ; i++ ) {
+            unsigned int count;
+            double *sub = data( msg.sub_fields[i].field, count );
+            memcpy( sub, buffer, count*sizeof( double ) );
+            buffer += count;
+        }
+    }
+
+    for( unsigned int imsg=0 ; imsg<exchange.nsend ; imsg++ ) {
+        MPI_Status status;
+        MPI_Wait( &( exchange.send[imsg].request ), &status );
+    }
+
+    exchange.nsend = 0;
+    exchange.nrecv = 0;
+}
+
+bool HaloMessages::before( const SubField &a, const SubField &b )
+{
+    return ( a.icomp < b.icomp ) || ( a.icomp == b.icomp && a.hindex < b.hindex );
+}
+
+HaloMessages::Message &HaloMessages::message( vector<Message> &messages, unsigned int &n, int rank, int iDim, int side )
+{
+    for( unsigned int imsg=0 ; imsg<n ; imsg++ ) {
+        if( messages[imsg].rank == rank && messages[imsg].iDim == iDim && messages[imsg].side == side ) {
+            return messages[imsg];
+        }
+    }
+    if( n == messages.size() ) {
+        messages.resize( n+1 );
+    }
+    Message &msg = messages[n++];
+    msg.rank = rank;
+    msg.iDim = iDim;
+    msg.side = side;
+    msg.sub_fields.clear();
+    msg.request = MPI_REQUEST_NULL;
+    msg.node_rank = -1;
+    return msg;
+}
+
+double *HaloMessages::data( Field *field, unsigned int &count )
+{
+    cField *cfield = dynamic_cast<cField *>( field );
+    if( cfield ) {
+        count = 2*cfield->number_of_points_;
+        return reinterpret_cast<double *>( cfield->cdata_ );
+    }
+    count = field->number_of_points_;
+    return field->data_;
+}
+
+unsigned int HaloMessages::size( const Message &msg )
+{
+    unsigned int size = 0, count;
+    for( unsigned int i=0 ; i<msg.sub_fields.size() ; i++ ) {
+        data( msg.sub_fields[i].field, count );
+        size += count;
+    }
+    return size;
+}
+
+bool HaloMessages::packShared( Exchange &exchange, const Message &msg )
+{
+    unsigned int size = HaloMessages::size( msg ), count;
+    const bool fits = exchange.used + size <= exchange.capacity;
+
+    // Offset -1: sent through MPI
+    double *header = exchange.segment + 2 + exchange.node_segments.size() + 5*exchange.nshared;
+    header[0] = msg.node_rank;
+    header[1] = msg.iDim;
+    header[2] = msg.side;
+    header[3] = fits ? ( double )exchange.used : -1.;
+    header[4] = size;
+    exchange.nshared++;
+    if( !fits ) {
+        return false;
+    }
+
+    double *buffer = exchange.segment + exchange.used;
+    for( unsigned int i=0 ; i<msg.sub_fields.size() ; i++ ) {
+        double *sub = data( msg.sub_fields[i].field, count );
+        memcpy( buffer, sub, count*sizeof( double ) );
+        buffer += count;
+    }
+    exchange.used += size;
+    return true;
+}
+
+void HaloMessages::sendMPI( Exchange &exchange, Message &msg )
+{
+    unsigned int size = HaloMessages::size( msg ), count;
+    msg.buffer.resize( size );
+    double *buffer = &msg.buffer[0];
+    for( unsigned int i=0 ; i<msg.sub_fields.size() ; i++ ) {
+        double *sub = data( msg.sub_fields[i].field, count );
+        memcpy( buffer, sub, count*sizeof( double ) );
+        buffer += count;
+    }
+    MPI_Isend( &msg.buffer[0], size, MPI_DOUBLE, msg.rank, exchange.tag + msg.iDim*2 + msg.side,
+               exchange.comm, &msg.request );
+}
+
+void HaloMessages::progress( Exchange &exchange )
+{
+    // The messages which did not fit in the segments go through MPI: while a process waits for the segment of a
+    // neighbor, it must let MPI progress, as this neighbor may be waiting for one of its messages
+    int flag;
+    MPI_Iprobe( MPI_ANY_SOURCE, MPI_ANY_TAG, exchange.comm, &flag, MPI_STATUS_IGNORE );
+}
+
+void HaloMessages::waitReaders( Exchange &exchange )
+{
+    // Each reader acknowledges the sequence number in its own segment
+    for( unsigned int i=0 ; i<exchange.readers.size() ; i++ ) {
+        volatile const double *ack = exchange.node_segments[exchange.readers[i]] + 2 + exchange.node_me;
+        while( true ) {
+            MPI_Win_sync( exchange.window );
+            if( ( unsigned int )*ack == exchange.sequence ) {
+                break;
+            }
+            progress( exchange );
+        }
+    }
+    exchange.readers.clear();
+}
+
+void HaloMessages::readShared( Exchange &exchange )
+{
+    const size_t messages = 2 + exchange.node_segments.size();
+
+    if( exchange.window == MPI_WIN_NULL ) {
+        // First exchange: allocate the window on the whole node, then pack the messages
+        // The allocation is collective: all the processes of the node must be in the first wait of the same exchange
+        long count = exchange.header_size;
+        for( unsigned int imsg=0 ; imsg<exchange.nsend ; imsg++ ) {
+            if( exchange.send[imsg].node_rank >= 0 ) {
+                count += size( exchange.send[imsg] );
+            }
+        }
+        long values[3] = { count, exchange.tag, -exchange.tag };
+        MPI_Allreduce( MPI_IN_PLACE, values, 3, MPI_LONG, MPI_MAX, exchange.node_comm );
+        if( values[1] != exchange.tag || -values[2] != exchange.tag ) {
+            ERROR( "The shared memory windows of the halo exchanges are not allocated in the same order on the node" );
+        }
+        allocateShared( exchange, values[0] );
+        for( unsigned int imsg=0 ; imsg<exchange.nsend ; imsg++ ) {
+            if( exchange.send[imsg].node_rank >= 0 && !packShared( exchange, exchange.send[imsg] ) ) {
+                sendMPI( exchange, exchange.send[imsg] );
+            }
+        }
+        return readShared( exchange );
+    }
+
+    // Publishes the segment: the sequence number is written after the messages
+    exchange.sequence++;
+    exchange.segment[1] = exchange.nshared;
+    for( unsigned int i=0 ; i<exchange.nshared ; i++ ) {
+        int reader = ( int )exchange.segment[messages + 5*i];
+        if( find( exchange.readers.begin(), exchange.readers.end(), reader ) == exchange.readers.end() ) {
+            exchange.readers.push_back( reader );
+        }
+    }
+    MPI_Win_sync( exchange.window );
+    exchange.segment[0] = exchange.sequence;
+    MPI_Win_sync( exchange.window );
+
+    vector<int> writers;
+    for( unsigned int imsg=0 ; imsg<exchange.nrecv ; imsg++ ) {
+        Message &msg = exchange.recv[imsg];
+        if( msg.node_rank < 0 ) {
+            continue;
+        }
+        // Waits for the neighbor to publish this exchange in its segment
+        const double *segment = exchange.node_segments[msg.node_rank];
+        volatile const double *sequence = segment;
+        while( true ) {
+            MPI_Win_sync( exchange.window );
+            if( ( unsigned int )*sequence == exchange.sequence ) {
+                break;
+            }
+            progress( exchange );
+        }
+        if( find( writers.begin(), writers.end(), msg.node_rank ) == writers.end() ) {
+            writers.push_back( msg.node_rank );
+        }
+
+        // Sent from the opposite side of the neighbor
+        const double *header = NULL;
+        for( unsigned int i=0 ; i<( unsigned int )segment[1] ; i++ ) {
+            const double *h = segment + messages + 5*i;
+            if( ( int )h[0] == exchange.node_me && ( int )h[1] == msg.iDim && ( int )h[2] == ( msg.side+1 )%2 ) {
+                header = h;
+                break;
+            }
+        }
+        if( !header ) {
+            ERROR( "Halo message from process " << msg.rank << " not found in shared memory" );
+        }
+        const double *buffer;
+        if( header[3] < 0. ) {
+            // Did not fit in the segment of the neighbor
+            msg.buffer.resize( ( size_t )header[4] );
+            MPI_Status status;
+            MPI_Recv( &msg.buffer[0], msg.buffer.size(), MPI_DOUBLE, msg.rank,
+                      exchange.tag + msg.iDim*2 + ( msg.side+1 )%2, exchange.comm, &status );
+            buffer = msg.buffer.data();
+        } else {
+            buffer = segment + ( size_t )header[3];
+        }
+        for( unsigned int i=0 ; i<msg.sub_fields.size() ; i++ ) {
+            unsigned int count;
+            double *sub = data( msg.sub_fields[i].field, count );
+            memcpy( sub, buffer, count*sizeof( double ) );
+            buffer += count;
+        }
+    }
+
+    // Acknowledges the messages read, the neighbors can overwrite their segments (see waitReaders)
+    MPI_Win_sync( exchange.window );
+    for( unsigned int i=0 ; i<writers.size() ; i++ ) {
+        exchange.segment[2 + writers[i]] = exchange.sequence;
+    }
+    MPI_Win_sync( exchange.window );
+
+    exchange.nshared = 0;
+    exchange.used = exchange.header_size;
+}
+
+void HaloMessages::allocateShared( Exchange &exchange, size_t count )
+{
+    freeShared( exchange );
+
+    // Margin for the following exchanges (load balancing, moving window)
+    exchange.capacity = count + count/4;
+    MPI_Win_allocate_shared( exchange.capacity*sizeof( double ), sizeof( double ), MPI_INFO_NULL, exchange.node_comm,
+                             &exchange.segment, &exchange.window );
+    int node_size;
+    MPI_Comm_size( exchange.node_comm, &node_size );
+    exchange.node_segments.resize( node_size );
+    for( int irk=0 ; irk<node_size ; irk++ ) {
+        MPI_Aint segment_size;
+        int disp_unit;
+        MPI_Win_shared_query( exchange.window, irk, &segment_size, &disp_unit, &exchange.node_segments[irk] );
+    }
+    // Passive target epoch for the whole run, synchronized with MPI_Win_sync and the sequence numbers
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, exchange.window );
+
+    exchange.nshared = 0;
+    exchange.used = exchange.header_size;
+    for( size_t i=0 ; i<exchange.header_size ; i++ ) {
+        exchange.segment[i] = 0;
+    }
+    // The segments of the other processes are initialized
+    MPI_Barrier( exchange.node_comm );
+}
+
+void HaloMessages::freeShared( Exchange &exchange )
+{
+    if( exchange.window == MPI_WIN_NULL ) {
+        return;
+    }
+    MPI_Win_unlock_all( exchange.window );
+    MPI_Win_free( &exchange.window );
+    exchange.segment = NULL;
+    exchange.node_segments.clear();
+    exchange.capacity = 0;
+}
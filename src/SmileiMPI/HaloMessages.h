@@ -0,0 +1,136 @@
+#ifndef HALOMESSAGES_H
+#define HALOMESSAGES_H
+
+#include <mpi.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Field;
+class VectorPatch;
+class SmileiMPI;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class HaloMessages (Main.aggregate_communications)
+//! The sub-fields sendFields_ of all the patches bound for the same neighbor MPI process, in a given direction and
+//! on a given side, are packed in a single message, instead of one message per patch (AsyncMPIbuffers).
+//! An exchange is identified by a name (one per set of fields in flight at the same time). Its messages have their own
+//! tags, assigned at its first post, which must therefore happen in the same order on all the processes. It is made of:
+//!  - post: packs the sub-fields of a direction and posts the messages (may be called for several directions)
+//!  - wait: waits for all the messages of the exchange and unpacks them in the sub-fields recvFields_
+//! Both functions must be called by a single thread (omp single).
+//! The messages are ordered by the hindex of the sending patch: the sender sorts its patches by their own hindex,
+//! the receiver sorts its patches by the hindex of their neighbor. They are rebuilt at each exchange, so that they
+//! follow the load balancing and the moving window, but the buffers are kept.
+//! With Main.shared_memory_communications, the messages to the processes of the same node are packed in a segment
+//! of a shared window (MPI_Win_allocate_shared, one per exchange) and read there directly by the receivers, in wait.
+//! The segment starts with a header: the sequence number of the last exchange published in the segment, the number
+//! of messages, the sequence number of the last exchange read in the segment of each process of the node, then the
+//! list of the messages. A receiver only waits for the sequence numbers of its neighbors, and a sender only waits for
+//! the acknowledgments of its neighbors before packing the next exchange: there is no synchronization of the node.
+//! The window is allocated, collectively, at the first wait of the exchange: all the processes of the node must do
+//! their first exchanges in the same order (checked at the allocation), which is also required by the tags. A message that no longer fits in the segment
+//! (load balancing, moving window) is sent through MPI instead, and its entry in the header says so: MPI progresses
+//! while a process waits for a neighbor in shared memory.
+//  --------------------------------------------------------------------------------------------------------------------
+class HaloMessages
+{
+public:
+    HaloMessages() {};
+    ~HaloMessages();
+
+    //! Packs and posts the sub-fields of the direction iDim
+    //! fields[icomp*patches.size()+i] is the component icomp of the patch vecPatches(patches[i])
+    void post( const std::string &name, const std::vector<Field *> &fields, const std::vector<int> &patches,
+               int iDim, VectorPatch &vecPatches, SmileiMPI *smpi );
+
+    //! Waits for the messages posted under this name and unpacks them
+    void wait( const std::string &name );
+
+    //! True if the exchange is done through aggregated messages (post has been called once for this name)
+    inline bool aggregates( const std::string &name ) const
+    {
+        return exchanges_.find( name ) != exchanges_.end();
+    }
+
+private:
+    //! Sub-field of a patch in a message
+    struct SubField {
+        unsigned int icomp;
+        unsigned int hindex;
+        Field *field;
+    };
+    //! Message to (or from) a neighbor process, in a direction and on a side
+    struct Message {
+        int rank;
+        int iDim;
+        int side;
+        std::vector<SubField> sub_fields;
+        std::vector<double> buffer;
+        MPI_Request request;
+        //! Rank of the neighbor in SmileiMPI::node_comm, -1 if the message goes through MPI
+        int node_rank;
+    };
+    //! Messages of one exchange: only the first nsend/nrecv are in use, the others keep their buffers
+    struct Exchange {
+        int tag;
+        std::vector<Message> send, recv;
+        unsigned int nsend, nrecv;
+        //! Communicator of the messages through MPI
+        MPI_Comm comm;
+        
+        // Shared memory (MPI_COMM_NULL / MPI_WIN_NULL if not used)
+        MPI_Comm node_comm;
+        int node_me;
+        MPI_Win window;
+        //! Segment of each process of the node in the window (segment = own segment)
+        std::vector<double *> node_segments;
+        double *segment;
+        //! Sizes (in doubles) of a segment, of its header and of the part in use
+        size_t capacity, header_size, used;
+        //! Number of messages in the header
+        unsigned int nshared;
+        //! Sequence number of the exchange (number of exchanges published in the segment)
+        unsigned int sequence;
+        //! Node ranks of the processes that read the last exchange published in the segment
+        std::vector<int> readers;
+    };
+
+    //! Order of the sub-fields in a message (component, then hindex of the sending patch)
+    static bool before( const SubField &a, const SubField &b );
+
+    //! Message of the exchange to rank (iDim, side), created if it does not exist yet
+    static Message &message( std::vector<Message> &messages, unsigned int &n, int rank, int iDim, int side );
+
+    //! Data and size (in doubles) of a sub-field (real or complex)
+    static double *data( Field *field, unsigned int &count );
+
+    //! Size (in doubles) of the sub-fields of a message
+    static unsigned int size( const Message &msg );
+
+    //! Packs a message in the shared segment and adds it to the header (false if it does not fit: the message is
+    //! then listed in the header as sent through MPI)
+    static bool packShared( Exchange &exchange, const Message &msg );
+
+    //! Packs a message in a buffer and sends it through MPI
+    static void sendMPI( Exchange &exchange, Message &msg );
+
+    //! Lets MPI progress while waiting for the segment of a neighbor
+    static void progress( Exchange &exchange );
+
+    //! Waits until the processes of the node have read the last exchange published in the segment
+    static void waitReaders( Exchange &exchange );
+
+    //! Publishes the segment, then unpacks the messages of the processes of the same node from their segments
+    static void readShared( Exchange &exchange );
+
+    //! Allocates the shared window with segments of at least count doubles (collective on the node)
+    static void allocateShared( Exchange &exchange, size_t count );
+
+    //! Frees the shared window (collective on the node)
+    static void freeShared( Exchange &exchange );
+
+    std::map<std::string, Exchange> exchanges_;
+};
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef PERTHREADBUFFER_H
+#define PERTHREADBUFFER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PerThreadBuffer
+//! Temporary buffer owned by each OpenMP thread (used for the vectorization of Species::dynamics).
+//! It behaves as a std::vector<std::vector<T>> (operator[] returns the std::vector<T> of a thread), but:
+//!  - the vector of each thread lives in its own slot, aligned on and padded to twice the size of a cache line,
+//!    and its data ends with one slot of unused elements, so that neither the vector headers nor the data of
+//!    two threads share a cache line (no false sharing)
+//!  - the buffers only grow: `reserve` applies a high-water mark with a growth factor, and the capacity is
+//!    never released by resize/clear, so that the steady state of the simulation does not reallocate
+//!  - the allocated bytes of a thread are available for the memory report at the end of the run
+//  --------------------------------------------------------------------------------------------------------------------
+template<typename T>
+class PerThreadBuffer
+{
+public:
+    //! Size of the slot of one thread (two 64-byte cache lines, also covers the adjacent line prefetcher)
+    static const std::size_t slot_size = 128;
+
+    PerThreadBuffer() {}
+
+    //! Buffer of thread ithread
+    inline std::vector<T> &operator[]( std::size_t ithread )
+    {
+        return slots_[ithread].buffer;
+    }
+    inline const std::vector<T> &operator[]( std::size_t ithread ) const
+    {
+        return slots_[ithread].buffer;
+    }
+
+    //! Number of threads holding a buffer
+    inline std::size_t size() const
+    {
+        return slots_.size();
+    }
+
+    //! Set the number of threads holding a buffer
+    inline void resize( std::size_t n_threads )
+    {
+        slots_.resize( n_threads );
+    }
+
+    //! Remove all the buffers (releases their memory)
+    inline void clear()
+    {
+        slots_.clear();
+    }
+
+    //! Make sure the buffer of thread ithread can hold n elements without reallocation.
+    //! When the capacity is exceeded, the new capacity is n*growth_factor (high-water mark).
+    //! Returns true when the buffer has been reallocated.
+    inline bool reserve( std::size_t ithread, std::size_t n, float growth_factor = 1.3F )
+    {
+        std::vector<T> &buffer = slots_[ithread].buffer;
+        if( n <= buffer.capacity() ) {
+            return false;
+        }
+        buffer.reserve( static_cast<std::size_t>( n * growth_factor ) + slack );
+        return true;
+    }
+
+    //! Memory allocated by the buffer of thread ithread, in bytes
+    inline std::size_t allocatedBytes( std::size_t ithread ) const
+    {
+        return ithread < slots_.size() ? slots_[ithread].buffer.capacity() * sizeof( T ) : 0;
+    }
+
+private:
+    //! Number of unused elements at the end of a reallocated buffer, so that its last cache lines
+    //! are not shared with the data that the allocator places after it
+    static const std::size_t slack = ( slot_size + sizeof( T ) - 1 ) / sizeof( T );
+
+    struct alignas( slot_size ) Slot {
+        std::vector<T> buffer;
+    };
+
+    //! Allocator of the slots, as operator new does not honour the alignment of Slot before C++17
+    struct SlotAllocator {
+        typedef Slot value_type;
+        template<typename U> struct rebind {
+            typedef SlotAllocator other;
+        };
+        Slot *allocate( std::size_t n )
+        {
+            void *p = nullptr;
+            if( posix_memalign( &p, slot_size, n * sizeof( Slot ) ) != 0 ) {
+                throw std::bad_alloc();
+            }
+            return static_cast<Slot *>( p );
+        }
+        void deallocate( Slot *p, std::size_t )
+        {
+            std::free( p );
+        }
+        bool operator==( const SlotAllocator & ) const { return true; }
+        bool operator!=( const SlotAllocator & ) const { return false; }
+    };
+
+    std::vector<Slot, SlotAllocator> slots_;
+};
+
+#endif
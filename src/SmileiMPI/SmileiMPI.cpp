@@ -6,6 +6,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <iomanip>
 #include <fstream>
 
 #include "Params.h"
@@ -86,6 +87,13 @@ SmileiMPI::~SmileiMPI()
 {
     delete[]periods_;
 
+    if( halo_comm != MPI_COMM_NULL && halo_comm != world_ ) {
+        MPI_Comm_free( &halo_comm );
+    }
+    if( node_comm != MPI_COMM_NULL ) {
+        MPI_Comm_free( &node_comm );
+    }
+
     MPI_Finalize();
 
 } // END SmileiMPI::~SmileiMPI
@@ -150,13 +158,49 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     int n_envlaser = PyTools::nComponents( "LaserEnvelope" );
     
     use_BTIS3 = params.use_BTIS3;
+    persistent_communications = params.persistent_communications;
+    aggregate_communications = params.aggregate_communications;
+    if( aggregate_communications ) {
+        MPI_Comm_dup( world_, &halo_comm );
+    } else {
+        halo_comm = world_;
+    }
+    float_sums = params.float_sums;
+    float_sums_tolerance = params.float_sums_tolerance;
+    shared_memory_communications = params.shared_memory_communications;
+    if( shared_memory_communications ) {
+        // Processes of the same node, and their rank in node_comm (-1 for the other nodes)
+        MPI_Comm_split_type( world_, MPI_COMM_TYPE_SHARED, smilei_rk, MPI_INFO_NULL, &node_comm );
+        MPI_Group world_group, node_group;
+        MPI_Comm_group( world_, &world_group );
+        MPI_Comm_group( node_comm, &node_group );
+        std::vector<int> world_ranks( smilei_sz );
+        for( int irk=0 ; irk<smilei_sz ; irk++ ) {
+            world_ranks[irk] = irk;
+        }
+        node_rank.resize( smilei_sz );
+        MPI_Group_translate_ranks( world_group, smilei_sz, &world_ranks[0], node_group, &node_rank[0] );
+        for( int irk=0 ; irk<smilei_sz ; irk++ ) {
+            if( node_rank[irk] == MPI_UNDEFINED ) {
+                node_rank[irk] = -1;
+            }
+        }
+        MPI_Group_free( &world_group );
+        MPI_Group_free( &node_group );
+    } else {
+        node_comm = MPI_COMM_NULL;
+    }
 
 #ifdef _OPENMP
     dynamics_Epart.resize( omp_get_max_threads() );
     dynamics_Bpart.resize( omp_get_max_threads() );
+    dynamics_Epart_float.resize( omp_get_max_threads() );
+    dynamics_Bpart_float.resize( omp_get_max_threads() );
     dynamics_invgf.resize( omp_get_max_threads() );
     dynamics_iold.resize( omp_get_max_threads() );
     dynamics_deltaold.resize( omp_get_max_threads() );
+    dynamics_projector_inew.resize( omp_get_max_threads() );
+    dynamics_projector_deltanew.resize( omp_get_max_threads() );
     if (use_BTIS3){
         dynamics_Bpart_yBTIS3.resize( omp_get_max_threads() );
         dynamics_Bpart_zBTIS3.resize( omp_get_max_threads() );
@@ -182,9 +226,13 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
 #else
     dynamics_Epart.resize( 1 );
     dynamics_Bpart.resize( 1 );
+    dynamics_Epart_float.resize( 1 );
+    dynamics_Bpart_float.resize( 1 );
     dynamics_invgf.resize( 1 );
     dynamics_iold.resize( 1 );
     dynamics_deltaold.resize( 1 );
+    dynamics_projector_inew.resize( 1 );
+    dynamics_projector_deltanew.resize( 1 );
     if (use_BTIS3){
         dynamics_Bpart_yBTIS3.resize( 1 );
         dynamics_Bpart_zBTIS3.resize( 1 );
@@ -480,6 +528,43 @@ void SmileiMPI::init_patch_count( Params &params, DomainDecomposition *domain_de
 } // END init_patch_count
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//  Distribute patches of known loads
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::balance_patch_count( std::vector<double> &patch_load )
+{
+    unsigned int Npatches = patch_load.size();
+    if( Npatches < ( unsigned int )smilei_sz ) {
+        ERROR( "Not enough patches (" << Npatches << ") for " << smilei_sz << " MPI processes" );
+    }
+    double Tload = 0.;
+    for( unsigned int ipatch=0; ipatch<Npatches; ipatch++ ) {
+        Tload += patch_load[ipatch];
+    }
+
+    // Each rank takes at least one patch, then the next patches while their middle is below its share of the load,
+    // leaving at least one patch for each of the following ranks. The last rank takes what's left.
+    patch_count.assign( smilei_sz, 0 );
+    unsigned int ipatch = 0;
+    double Lcur = 0.;
+    for( int rk=0; rk<smilei_sz; rk++ ) {
+        double Tcur = Tload * ( rk+1 ) / smilei_sz;
+        unsigned int last = ( rk == smilei_sz-1 ) ? Npatches : Npatches - ( smilei_sz-1-rk );
+        do {
+            Lcur += patch_load[ipatch];
+            ipatch++;
+            patch_count[rk]++;
+        } while( ipatch < last && ( rk == smilei_sz-1 || Lcur + 0.5*patch_load[ipatch] <= Tcur ) );
+    }
+
+    patch_refHindexes.resize( patch_count.size(), 0 );
+    patch_refHindexes[0] = 0;
+    for( int rk=1 ; rk<smilei_sz ; rk++ ) {
+        patch_refHindexes[rk] = patch_refHindexes[rk-1] + patch_count[rk-1];
+    }
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //  Recompute patch distribution
 // ---------------------------------------------------------------------------------------------------------------------
@@ -2527,6 +2612,52 @@ void SmileiMPI::eraseBufferParticleTrail( const int ndim, const int istart, cons
 }
 
 
+//! Memory allocated by the dynamics buffers of thread ithread, in bytes
+long int SmileiMPI::getDynamicsBuffersMemory( const int ithread )
+{
+    return dynamics_Epart.allocatedBytes( ithread )
+           + dynamics_Bpart.allocatedBytes( ithread )
+           + dynamics_invgf.allocatedBytes( ithread )
+           + dynamics_iold.allocatedBytes( ithread )
+           + dynamics_deltaold.allocatedBytes( ithread )
+           + dynamics_projector_inew.allocatedBytes( ithread )
+           + dynamics_projector_deltanew.allocatedBytes( ithread )
+           + dynamics_eithetaold.allocatedBytes( ithread )
+           + dynamics_Bpart_yBTIS3.allocatedBytes( ithread )
+           + dynamics_Bpart_zBTIS3.allocatedBytes( ithread )
+           + dynamics_Epart_float.allocatedBytes( ithread )
+           + dynamics_Bpart_float.allocatedBytes( ithread )
+           + dynamics_GradPHIpart.allocatedBytes( ithread )
+           + dynamics_GradPHI_mpart.allocatedBytes( ithread )
+           + dynamics_PHIpart.allocatedBytes( ithread )
+           + dynamics_PHI_mpart.allocatedBytes( ithread )
+           + dynamics_inv_gamma_ponderomotive.allocatedBytes( ithread )
+           + dynamics_EnvEabs_part.allocatedBytes( ithread )
+           + dynamics_EnvExabs_part.allocatedBytes( ithread );
+}
+
+//! Print the peak memory of the dynamics buffers per thread
+//! As the capacity of the buffers never decreases, the current capacity is the peak
+void SmileiMPI::printDynamicsBuffersMemory()
+{
+    long int max_thread_mem( 0 ), total_mem( 0 );
+    for( unsigned int ithread=0 ; ithread<dynamics_invgf.size() ; ithread++ ) {
+        long int mem = getDynamicsBuffersMemory( ithread );
+        max_thread_mem = max( max_thread_mem, mem );
+        total_mem += mem;
+    }
+    long int global_max_thread_mem( 0 ), global_total_mem( 0 );
+    MPI_Reduce( &max_thread_mem, &global_max_thread_mem, 1, MPI_LONG, MPI_MAX, 0, world_ );
+    MPI_Reduce( &total_mem, &global_total_mem, 1, MPI_LONG, MPI_SUM, 0, world_ );
+
+    ostringstream t( "" );
+    t << "Particle dynamics buffers: "
+      << "Rank 0 thread max " << setprecision( 3 ) << ( double )max_thread_mem / 1024./1024. << " MB;   "
+      << "Global thread max " << ( double )global_max_thread_mem / 1024./1024. << " MB;   "
+      << "Global " << ( double )global_total_mem / 1024./1024./1024. << " GB";
+    MESSAGE( 1, t.str() );
+}
+
 #if defined( SMILEI_ACCELERATOR_GPU_OMP ) || defined( SMILEI_ACCELERATOR_GPU_OACC )
 
 template <typename Container>
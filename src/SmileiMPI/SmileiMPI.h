@@ -3,6 +3,7 @@
 
 #include <mpi.h>
 
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -10,6 +11,7 @@
 #include "Particles.h"
 #include "Tools.h"
 #include "gpu.h"
+#include "PerThreadBuffer.h"
 
 class Params;
 class Species;
@@ -58,6 +60,9 @@ public:
 
     // Recompute the patch_count vector. Browse patches and redistribute them in order to balance the load between MPI processes.
     void recompute_patch_count( Params &params, VectorPatch &vecpatches, double time_dual );
+    
+    // Compute the patch_count vector from the known load of all patches (contiguous shares of the total load)
+    void balance_patch_count( std::vector<double> &patch_load );
     // Returns the rank of the MPI process currently owning patch h.
     int hrank( int h );
 
@@ -206,38 +211,81 @@ public:
         return *tag_ub_ptr;
     }
 
+    //! Lets the MPI library progress the pending non-blocking communications
+    inline void progressCommunications()
+    {
+        int flag;
+        MPI_Iprobe( MPI_ANY_SOURCE, MPI_ANY_TAG, world_, &flag, MPI_STATUS_IGNORE );
+    }
+
+    //! Accumulates the squared rounding error and squared values of a sum message (see AsyncMPIbuffers::isendSum)
+    inline void accumulateFloatSumsError( double error2, double norm2, bool sent_in_double )
+    {
+        #pragma omp atomic
+        float_sums_error2_ += error2;
+        #pragma omp atomic
+        float_sums_norm2_ += norm2;
+        #pragma omp atomic
+        float_sums_messages_++;
+        if( sent_in_double ) {
+            #pragma omp atomic
+            float_sums_double_messages_++;
+        }
+    }
+
+    //! Relative rounding error of the sums sent in single precision, and fraction of the sum messages sent
+    //! in double precision, since the previous call
+    inline void getFloatSumsError( double &relative_error, double &double_fraction )
+    {
+        relative_error  = float_sums_norm2_ > 0. ? std::sqrt( float_sums_error2_ / float_sums_norm2_ ) : 0.;
+        double_fraction = float_sums_messages_ > 0 ? ( double )float_sums_double_messages_ / ( double )float_sums_messages_ : 0.;
+        float_sums_error2_ = 0.;
+        float_sums_norm2_ = 0.;
+        float_sums_messages_ = 0;
+        float_sums_double_messages_ = 0;
+    }
+
     // Global buffers for vectorization of Species::dynamics
+    // (one buffer per thread, see PerThreadBuffer)
     // -----------------------------------------------------
 
     //! value of the Efield
-    std::vector<std::vector<double>> dynamics_Epart;
+    PerThreadBuffer<double> dynamics_Epart;
     //! value of the Bfield
-    std::vector<std::vector<double>> dynamics_Bpart;
+    PerThreadBuffer<double> dynamics_Bpart;
     //! gamma factor
-    std::vector<std::vector<double>> dynamics_invgf;
+    PerThreadBuffer<double> dynamics_invgf;
     //! iold_pos
-    std::vector<std::vector<int>> dynamics_iold;
+    PerThreadBuffer<int> dynamics_iold;
     //! delta_old_pos
-    std::vector<std::vector<double>> dynamics_deltaold;
+    PerThreadBuffer<double> dynamics_deltaold;
+    //! new primal node of the particles (relative to the patch), computed with the cell keys for Projector3D2OrderV
+    PerThreadBuffer<int> dynamics_projector_inew;
+    //! distance of the particles to their new primal node, computed with the cell keys for Projector3D2OrderV
+    PerThreadBuffer<double> dynamics_projector_deltanew;
     //! theta old
-    std::vector<std::vector<std::complex<double>>> dynamics_eithetaold;
+    PerThreadBuffer<std::complex<double>> dynamics_eithetaold;
     //! value of the By field for BTIS3
-    std::vector<std::vector<double>> dynamics_Bpart_yBTIS3;
+    PerThreadBuffer<double> dynamics_Bpart_yBTIS3;
     //! value of the Bz field for BTIS3
-    std::vector<std::vector<double>> dynamics_Bpart_zBTIS3;
+    PerThreadBuffer<double> dynamics_Bpart_zBTIS3;
+    //! single-precision value of the Efield (species with mixed_precision)
+    PerThreadBuffer<float> dynamics_Epart_float;
+    //! single-precision value of the Bfield (species with mixed_precision)
+    PerThreadBuffer<float> dynamics_Bpart_float;
 
     //! value of the grad(AA*) at itime and itime-1
-    std::vector<std::vector<double>> dynamics_GradPHIpart;
-    std::vector<std::vector<double>> dynamics_GradPHI_mpart;
+    PerThreadBuffer<double> dynamics_GradPHIpart;
+    PerThreadBuffer<double> dynamics_GradPHI_mpart;
     //! value of the AA* at itime and itime-1
-    std::vector<std::vector<double>> dynamics_PHIpart;
-    std::vector<std::vector<double>> dynamics_PHI_mpart;
+    PerThreadBuffer<double> dynamics_PHIpart;
+    PerThreadBuffer<double> dynamics_PHI_mpart;
     //! inverse of the ponderomotive gamma, used in susceptibility and ponderomotive momentum Pusher
-    std::vector<std::vector<double>> dynamics_inv_gamma_ponderomotive;
+    PerThreadBuffer<double> dynamics_inv_gamma_ponderomotive;
     //! value of the EnvEabs used for envelope ionization
-    std::vector<std::vector<double>> dynamics_EnvEabs_part;
+    PerThreadBuffer<double> dynamics_EnvEabs_part;
     //! value of the EnvEabs used for envelope ionization
-    std::vector<std::vector<double>> dynamics_EnvExabs_part;
+    PerThreadBuffer<double> dynamics_EnvExabs_part;
 
     //! Return buffer size in thread ithread
     inline int __attribute__((always_inline)) getBufferSize(const int ithread)
@@ -248,6 +296,12 @@ public:
     //! Erase Particles from istart ot the end in the buffers of thread ithread
     void eraseBufferParticleTrail( const int ndim, const int istart, const int ithread, bool isAM = false );
 
+    //! Memory allocated by the dynamics buffers of thread ithread, in bytes
+    long int getDynamicsBuffersMemory( const int ithread );
+
+    //! Print the peak memory of the dynamics buffers per thread (the buffers never shrink)
+    void printDynamicsBuffersMemory();
+
 #if defined( SMILEI_ACCELERATOR_GPU_OMP ) || defined( SMILEI_ACCELERATOR_GPU_OACC )
     //! Map CPU buffers onto the GPU to at least accommodate particle_count
     //! particles. This method tries to reduce the number of
@@ -269,43 +323,61 @@ public:
                               float        growth_factor = 1.3F );
 #endif
 
-    inline void resizeBuffers( int ithread, int ndim_field, int npart, bool isAM = false )
+    //! Resize the dynamics buffers of thread ithread for npart particles
+    //! With mixed_precision, the interpolated fields go in the single-precision buffers only
+    inline void resizeBuffers( int ithread, int ndim_field, int npart, bool isAM = false, bool mixed_precision = false )
     {
-        dynamics_Epart[ithread].resize( 3*npart );
-        dynamics_Bpart[ithread].resize( 3*npart );
-        dynamics_invgf[ithread].resize( npart );
-        dynamics_iold[ithread].resize( ndim_field*npart );
-        dynamics_deltaold[ithread].resize( ndim_field*npart );
+        if( mixed_precision ) {
+            growBuffer( dynamics_Epart_float, ithread, 3*npart );
+            growBuffer( dynamics_Bpart_float, ithread, 3*npart );
+        } else {
+            growBuffer( dynamics_Epart, ithread, 3*npart );
+            growBuffer( dynamics_Bpart, ithread, 3*npart );
+        }
+        growBuffer( dynamics_invgf, ithread, npart );
+        growBuffer( dynamics_iold, ithread, ndim_field*npart );
+        growBuffer( dynamics_deltaold, ithread, ndim_field*npart );
         if(use_BTIS3){
-            dynamics_Bpart_yBTIS3[ithread].resize( npart );
-            dynamics_Bpart_zBTIS3[ithread].resize( npart );
+            growBuffer( dynamics_Bpart_yBTIS3, ithread, npart );
+            growBuffer( dynamics_Bpart_zBTIS3, ithread, npart );
         }
         if( isAM ) {
-            dynamics_eithetaold[ithread].resize( npart );
+            growBuffer( dynamics_eithetaold, ithread, npart );
         }
 
         if( dynamics_GradPHIpart.size() > 0 ) {
-            dynamics_GradPHIpart[ithread].resize( 3*npart );
-            dynamics_GradPHI_mpart[ithread].resize( 3*npart );
-            dynamics_PHIpart[ithread].resize( npart );
-            dynamics_PHI_mpart[ithread].resize( npart );
-            dynamics_inv_gamma_ponderomotive[ithread].resize( npart );
+            growBuffer( dynamics_GradPHIpart, ithread, 3*npart );
+            growBuffer( dynamics_GradPHI_mpart, ithread, 3*npart );
+            growBuffer( dynamics_PHIpart, ithread, npart );
+            growBuffer( dynamics_PHI_mpart, ithread, npart );
+            growBuffer( dynamics_inv_gamma_ponderomotive, ithread, npart );
             if ( dynamics_EnvEabs_part.size() > 0 ){
-                dynamics_EnvEabs_part[ithread].resize( npart );
-                dynamics_EnvExabs_part[ithread].resize( npart );
+                growBuffer( dynamics_EnvEabs_part, ithread, npart );
+                growBuffer( dynamics_EnvExabs_part, ithread, npart );
             }
         }
     }
 
 
+    //! Resize the buffers of the new primal node of the particles, filled with the cell keys for Projector3D2OrderV
+    inline void resizeProjectorNodeBuffers( int ithread, int ndim_field, int npart )
+    {
+        growBuffer( dynamics_projector_inew, ithread, ndim_field*npart );
+        growBuffer( dynamics_projector_deltanew, ithread, ndim_field*npart );
+    }
+
         // Resize buffers vector for a given number of buffers
     inline void resizeBuffers( int n_buffers, bool isAM = false)
     {
         dynamics_Epart.resize( n_buffers );
         dynamics_Bpart.resize( n_buffers );
+        dynamics_Epart_float.resize( n_buffers );
+        dynamics_Bpart_float.resize( n_buffers );
         dynamics_invgf.resize( n_buffers );
         dynamics_iold.resize( n_buffers );
         dynamics_deltaold.resize( n_buffers );
+        dynamics_projector_inew.resize( n_buffers );
+        dynamics_projector_deltanew.resize( n_buffers );
         if(use_BTIS3){
             dynamics_Bpart_yBTIS3.resize( n_buffers );
             dynamics_Bpart_zBTIS3.resize( n_buffers );
@@ -332,9 +404,13 @@ public:
     {
         dynamics_Epart[buffer_id].resize( 1 );
         dynamics_Bpart[buffer_id].resize( 1 );
+        dynamics_Epart_float[buffer_id].clear();
+        dynamics_Bpart_float[buffer_id].clear();
         dynamics_invgf[buffer_id].resize( 1 );
         dynamics_iold[buffer_id].resize( 1 );
         dynamics_deltaold[buffer_id].resize( 1 );
+        dynamics_projector_inew[buffer_id].clear();
+        dynamics_projector_deltanew[buffer_id].clear();
         if(use_BTIS3){
             dynamics_Bpart_yBTIS3[buffer_id].resize( 1 );
             dynamics_Bpart_zBTIS3[buffer_id].resize( 1 );
@@ -359,10 +435,10 @@ public:
     // Resize buffers for old properties only
     inline void resizeOldPropertiesBuffer( int ithread, int ndim_field, int npart, bool isAM = false )
     {
-        dynamics_iold[ithread].resize( ndim_field*npart );
-        dynamics_deltaold[ithread].resize( ndim_field*npart );
+        growBuffer( dynamics_iold, ithread, ndim_field*npart );
+        growBuffer( dynamics_deltaold, ithread, ndim_field*npart );
         if( isAM ) {
-            dynamics_eithetaold[ithread].resize( npart );
+            growBuffer( dynamics_eithetaold, ithread, npart );
         }
     }
 
@@ -404,10 +480,34 @@ public:
 
     bool use_BTIS3;
 
+    //! Field exchanges through persistent MPI requests
+    bool persistent_communications;
+
+    //! Field exchanges aggregated in one message per neighbor MPI process (see HaloMessages)
+    bool aggregate_communications;
+    //! Communicator of the aggregated messages (duplicate of world_, their tags do not depend on the patches)
+    MPI_Comm halo_comm = MPI_COMM_NULL;
+
+    //! Aggregated messages between processes of the same node read in shared memory (see HaloMessages)
+    bool shared_memory_communications;
+    //! Communicator of the processes of the same node (shared_memory_communications only)
+    MPI_Comm node_comm = MPI_COMM_NULL;
+    //! Rank in node_comm of each process of world_ (-1 if on another node)
+    std::vector<int> node_rank;
+
+    //! Sums of the total densities sent in single precision (see AsyncMPIbuffers::isendSum)
+    bool float_sums;
+    //! Maximum relative rounding error of a sum message sent in single precision
+    double float_sums_tolerance;
+
 protected:
     //! Global MPI Communicator
     MPI_Comm world_;
 
+    //! Rounding errors of the sums sent in single precision (see accumulateFloatSumsError)
+    double float_sums_error2_ = 0., float_sums_norm2_ = 0.;
+    unsigned int float_sums_messages_ = 0, float_sums_double_messages_ = 0;
+
     //! Number of MPI process in the current communicator
     int smilei_sz;
     //! MPI process Id in the current communicator
@@ -427,6 +527,19 @@ protected:
     //Number of patches owned by each mpi process.
     std::vector<int>  patch_count, capabilities, patch_refHindexes;
     int Tcapabilities; //Default = smilei_sz (1 per MPI rank)
+
+    //! Resize the buffer of thread ithread to n elements
+    //! On CPU, the capacity follows a high-water mark (see PerThreadBuffer::reserve)
+    //! so that the buffers are not reallocated at each call of Species::dynamics.
+    //! On GPU, the capacity is managed by resizeDeviceBuffers.
+    template<typename T>
+    static inline void growBuffer( PerThreadBuffer<T> &buffer, int ithread, int n )
+    {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+        buffer.reserve( ithread, n );
+#endif
+        buffer[ithread].resize( n );
+    }
 };
 
 
@@ -103,6 +103,13 @@ void SmileiMPI_test::init( Params &params, DomainDecomposition *domain_decomposi
     patch_count.resize( smilei_sz, 0 );
     Tcapabilities = smilei_sz;
     use_BTIS3 = params.use_BTIS3;
+    persistent_communications = params.persistent_communications;
+    aggregate_communications = params.aggregate_communications;
+    halo_comm = world_;
+    shared_memory_communications = false;
+    float_sums = false;
+    float_sums_tolerance = 0.;
+    node_comm = MPI_COMM_NULL;
 
     remove( "patch_load.txt" );
 
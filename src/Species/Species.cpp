@@ -53,6 +53,7 @@ Species::Species( Params &params, Patch *patch ) :
     radiation_model_( "none" ),
     time_frozen_( 0 ),
     radiating_( false ),
+    mixed_precision_( false ),
     relativistic_field_initialization_( false ),
     iter_relativistic_initialization_( 0 ),
     ionization_model_( "none" ),
@@ -261,7 +262,7 @@ void Species::initOperators( Params &params, Patch *patch )
 {
 
     // interpolation operator (virtual)
-    Interp = InterpolatorFactory::create( params, patch, this->vectorized_operators ); // + patchId -> idx_domain_begin (now = ref smpi)
+    Interp = InterpolatorFactory::create( params, patch, this->vectorized_operators, this->mixed_precision_ ); // + patchId -> idx_domain_begin (now = ref smpi)
 
     // assign the correct Pusher to Push
     Push = PusherFactory::create( params, this );
@@ -299,6 +300,12 @@ void Species::initOperators( Params &params, Patch *patch )
             MPI_buffer_.partSend[iDim][iNeighbor]->initialize( 0, ( *particles ) );
         }
     }
+    for( unsigned int k=0 ; k < MPI_buffer_.cornerSend.size() ; k++ ) {
+        if( MPI_buffer_.cornerSend[k] ) {
+            MPI_buffer_.cornerRecv[k]->initialize( 0, ( *particles ) );
+            MPI_buffer_.cornerSend[k]->initialize( 0, ( *particles ) );
+        }
+    }
     typePartSend.resize( nDim_field*2, MPI_DATATYPE_NULL );
     typePartRecv.resize( nDim_field*2, MPI_DATATYPE_NULL );
     exchangePatch = MPI_DATATYPE_NULL;
@@ -1307,63 +1314,55 @@ void Species::reconfiguration( Params &, Patch * )
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
-//! Sort particles using the count sort method
+//! Sort particles according to their cell_keys using the count sort method
+//! The particles are copied in the order of the cells into the buffer particles_sorted[0], whose vectors are
+//! then swapped with those of particles. The old storage is released so that no duplicate is kept between sorts.
+//! Each particle is moved once and the memory is accessed contiguously: faster than a sort in place
+//! when a large fraction of the particles changed cell.
+//! All the cell_keys must be valid (no particle to delete), first_index and last_index are recomputed.
 // ---------------------------------------------------------------------------------------------------------------------
-void Species::countSortParticles( Params &params )
+void Species::countSortParticles( Params & )
 {
-    unsigned int ip, npart, ixy, tot, oc, nxy, token;
-    int ix, iy;
-    double x, y;
-
-    nxy = params.patch_size_[0]*params.patch_size_[1];
-    token = ( particles == &particles_sorted[0] );
-
-    int indices[nxy];
-    npart = particles->size();
-    //particles_sorted = particles ;
-    particles_sorted[token].initialize( npart, *particles );
-
-    for( unsigned int i=0; i < nxy ; i++ ) {
-        indices[i] = 0 ;
-    }
+    const unsigned int npart = particles->size();
+    const unsigned int ncell = particles->first_index.size();
+    int *const cell_keys = particles->getPtrCellKeys();
 
     // first loop counts the # of particles in each cell
-    for( ip=0; ip < npart; ip++ ) {
-        x = particles->position( 0, ip )-min_loc;
-        y = particles->position( 1, ip )-min_loc_vec[1];
-
-        ix = floor( x * dx_inv_[0] ) ;
-        iy = floor( y * dx_inv_[1] ) ;
-
-        ixy = iy + ix*params.patch_size_[1];
-
-
-        indices[ixy] ++;
+    for( unsigned int ic=0; ic < ncell; ic++ ) {
+        particles->last_index[ic] = 0;
+    }
+    for( unsigned int ip=0; ip < npart; ip++ ) {
+        particles->last_index[cell_keys[ip]]++;
     }
 
     // second loop convert the count array in cumulative sum
-    tot=0;
-    for( ixy=0; ixy < nxy; ixy++ ) {
-        oc = indices[ixy];
-        indices[ixy] = tot;
-        tot += oc;
+    int tot = 0;
+    for( unsigned int ic=0; ic < ncell; ic++ ) {
+        const int count_ic = particles->last_index[ic];
+        particles->first_index[ic] = tot;
+        particles->last_index[ic] = tot;
+        tot += count_ic;
     }
 
-    // last loop puts the particles and update the count array
-    for( ip=0; ip < npart; ip++ ) {
-        x = particles->position( 0, ip )-min_loc;
-        y = particles->position( 1, ip )-min_loc_vec[1];
-
-        ix = floor( x * dx_inv_[1] ) ;
-        iy = floor( y * dx_inv_[2] ) ;
-
-        ixy = iy + ix*params.patch_size_[1];
-        particles->overwriteParticle( ip, particles_sorted[token], indices[ixy] );
-        indices[ixy]++;
+    // third loop puts the particles in the buffer and update last_index
+    particles_sorted[0].initialize( npart, *particles );
+    for( unsigned int ip=0; ip < npart; ip++ ) {
+        particles->overwriteParticle( ip, particles_sorted[0], particles->last_index[cell_keys[ip]] );
+        particles->last_index[cell_keys[ip]]++;
     }
 
-    particles = &particles_sorted[token] ;
+    // the sorted buffer becomes the particle storage, the old storage is released
+    particles->swapProperties( particles_sorted[0] );
+    particles_sorted[0].clear( true );
+    particles_sorted[0].shrinkToFit();
+    std::vector<int>().swap( particles_sorted[0].cell_keys );
 
+    // last loop recomputes the cell_keys in the sorted order
+    for( unsigned int ic=0; ic < ncell; ic++ ) {
+        for( int ip=particles->first_index[ic]; ip < particles->last_index[ic]; ip++ ) {
+            cell_keys[ip] = ic;
+        }
+    }
 }
 
 // Move all particles from another species to this one
@@ -267,6 +267,9 @@ public:
     //! whether to choose vectorized operators with respective sorting methods
     int vectorized_operators;
 
+    //! whether the interpolated fields are stored in single precision for the push
+    bool mixed_precision_;
+
     // Merging parameters :
     //! Merging method
     std::string merging_method_;
@@ -510,7 +513,7 @@ public:
     //! the best mode from the particle distribution
     virtual void reconfiguration( Params &param, Patch   *patch );
 
-    //! Counting sort method for particles
+    //! Counting sort of the particles according to their cell_keys (out of place, through particles_sorted[0])
     void countSortParticles( Params &param );
 
     //!
@@ -987,6 +987,37 @@ public:
             LINK_NAMELIST + std::string("#species") );
         }
 
+        // Extract the mixed-precision flag (interpolated fields stored in single precision)
+        PyTools::extract( "mixed_precision", this_species->mixed_precision_, "Species", ispec );
+        if( this_species->mixed_precision_ ) {
+#if defined( SMILEI_ACCELERATOR_GPU )
+            ERROR_NAMELIST( "For species '" << species_name << "', mixed_precision is not available on GPU",
+            LINK_NAMELIST + std::string("#mixed_precision") );
+#endif
+            if( params.vectorization_mode != "on"
+                || params.geometry != "3Dcartesian"
+                || params.interpolation_order != 2
+                || params.interpolator_ != "momentum-conserving" ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', mixed_precision requires the `3Dcartesian` geometry, "
+                    << "interpolation_order=2, the momentum-conserving interpolator and vectorization mode 'on'",
+                    LINK_NAMELIST + std::string("#mixed_precision") );
+            }
+            if( this_species->pusher_name_ != "boris" && this_species->pusher_name_ != "vay" ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', mixed_precision is only compatible with the 'boris' and 'vay' pushers",
+                LINK_NAMELIST + std::string("#mixed_precision") );
+            }
+            if( this_species->ionization_model_ != "none"
+                || this_species->radiation_model_ != "none"
+                || this_species->particles->interpolated_fields_
+                || params.Laser_Envelope_model
+                || params.use_BTIS3 ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', mixed_precision is not compatible with ionization, "
+                    << "radiation reaction, keep_interpolated_fields, the envelope model or B-TIS3",
+                    LINK_NAMELIST + std::string("#mixed_precision") );
+            }
+            MESSAGE( 2, "> Mixed precision: interpolated fields stored in single precision" );
+        }
+
         return this_species;
     } // End Species* create()
 
@@ -1064,6 +1095,7 @@ public:
         new_species->size_proj_buffer_rhoAM                   = species->size_proj_buffer_rhoAM;
         new_species->density_profile_type_                    = species->density_profile_type_;
         new_species->vectorized_operators                     = species->vectorized_operators;
+        new_species->mixed_precision_                         = species->mixed_precision_;
         new_species->merging_method_                          = species->merging_method_;
         new_species->has_merging_                             = species->has_merging_;
         new_species->merging_time_selection_                  = species->merging_time_selection_;
@@ -1,5 +1,6 @@
 #include "SpeciesV.h"
 
+#include <algorithm>
 #include <cmath>
 #include <ctime>
 #include <cstdlib>
@@ -35,6 +36,7 @@
 #include "Tools.h"
 
 #include "DiagnosticTrack.h"
+#include "Hilbert_functions.h"
 
 using namespace std;
 
@@ -47,6 +49,7 @@ SpeciesV::SpeciesV( Params &params, Patch *patch ) :
     Species( params, patch )
 {
     initCluster( params, patch );
+    movers_tracked_ = false;
     npack_ = 0 ;
     packsize_ = 0;
 
@@ -76,6 +79,7 @@ void SpeciesV::initCluster( Params &params, Patch *patch )
     particles->last_index.resize( ncells, 0 );
     particles->first_index.resize( ncells, 0 );
     count.resize( ncells, 0 );
+    initCellOrdering( params );
 
     //Size in each dimension of the buffers on which each bin are projected
     //In 1D the particles of a given bin can be projected on 6 different nodes at the second order (oversize = 2)
@@ -127,6 +131,69 @@ void SpeciesV::initCluster( Params &params, Patch *patch )
 
 }//END initCluster
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Order of the cells of the patch (Vectorization.cell_ordering)
+// The cells are ranked along a Morton or Hilbert curve drawn on the smallest power-of-2 box containing the
+// (patch_size_+1) dual cells of each dimension. The particles are then sorted by rank instead of the
+// row-major index, so that consecutive cells are neighbours in all the directions.
+// ---------------------------------------------------------------------------------------------------------------------
+void SpeciesV::initCellOrdering( Params &params )
+{
+    cell_rank_.clear();
+    ranked_cell_.clear();
+    if( params.cell_ordering == "row_major" ) {
+        return;
+    }
+
+    unsigned int n[3] = { 1, 1, 1 }, m[3] = { 0, 0, 0 };
+    for( unsigned int iDim=0 ; iDim<nDim_field ; iDim++ ) {
+        n[iDim] = params.patch_size_[iDim]+1;
+        while( ( 1u << m[iDim] ) < n[iDim] ) {
+            m[iDim]++;
+        }
+    }
+
+    // Index of each cell along the curve, cells in row-major order
+    const unsigned int ncells = n[0]*n[1]*n[2];
+    vector<pair<uint64_t, int> > curve( ncells );
+    for( unsigned int ix=0 ; ix<n[0] ; ix++ ) {
+        for( unsigned int iy=0 ; iy<n[1] ; iy++ ) {
+            for( unsigned int iz=0 ; iz<n[2] ; iz++ ) {
+                const int icell = ( ix*n[1] + iy )*n[2] + iz;
+                uint64_t index = 0;
+                if( params.cell_ordering == "hilbert" ) {
+                    if( nDim_field == 3 ) {
+                        index = generalhilbertindex( m[0], m[1], m[2], ix, iy, iz );
+                    } else {
+                        index = generalhilbertindex( m[0], m[1], ix, iy );
+                    }
+                } else {
+                    // Morton: interleaved bits of the coordinates
+                    const unsigned int coordinates[3] = { ix, iy, iz };
+                    unsigned int bit_position = 0;
+                    for( unsigned int ibit=0 ; ibit<max( m[0], max( m[1], m[2] ) ) ; ibit++ ) {
+                        for( unsigned int iDim=0 ; iDim<nDim_field ; iDim++ ) {
+                            if( ibit < m[iDim] ) {
+                                index |= ( uint64_t )( ( coordinates[iDim] >> ibit ) & 1 ) << bit_position;
+                                bit_position++;
+                            }
+                        }
+                    }
+                }
+                curve[icell] = make_pair( index, icell );
+            }
+        }
+    }
+    sort( curve.begin(), curve.end() );
+
+    cell_rank_.resize( ncells );
+    ranked_cell_.resize( ncells );
+    for( unsigned int irank=0 ; irank<ncells ; irank++ ) {
+        ranked_cell_[irank] = curve[irank].second;
+        cell_rank_[curve[irank].second] = irank;
+    }
+}
+
 
 void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                          ElectroMagn *EMfields, Params &params, bool diag_flag,
@@ -167,6 +234,9 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
     int tid( 0 );
     std::vector<double> nrj_lost_per_thd( 1, 0. );
 
+    movers_.clear();
+    movers_tracked_ = false;
+
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
@@ -193,10 +263,31 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
         }
 
 
+        const bool fused_dynamics = fusedDynamicsApplies( params );
+
         for( unsigned int ipack = 0 ; ipack < npack_ ; ipack++ ) {
 
             int start = particles->first_index[ipack*packsize_], stop = particles->last_index[( ipack+1 ) * packsize_-1 ], nparts_in_pack = stop - start;
-            smpi->resizeBuffers( ithread, nDim_field, nparts_in_pack, params.geometry=="AMcylindrical" );
+            smpi->resizeBuffers( ithread, nDim_field, nparts_in_pack, params.geometry=="AMcylindrical", mixed_precision_ );
+
+            // Interpolation, push and projection fused per cluster of cells
+            if( fused_dynamics ) {
+#ifdef  __DETAILED_TIMERS
+                timer = MPI_Wtime();
+#endif
+                smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,1);
+                fusedDynamics( EMfields, params, diag_flag, partWalls, patch, smpi,
+                               ispec, ithread, ipack, nrj_lost_per_thd[tid] );
+                smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,1);
+#ifdef  __DETAILED_TIMERS
+                // All the operators are accounted in the pusher timer
+                patch->patch_timers_[1] += MPI_Wtime() - timer;
+#endif
+                for( unsigned int ithd=0 ; ithd<nrj_lost_per_thd.size() ; ithd++ ) {
+                    nrj_bc_lost += nrj_lost_per_thd[tid];
+                }
+                continue;
+            }
 
 #ifdef  __DETAILED_TIMERS
             timer = MPI_Wtime();
@@ -469,12 +560,28 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
             //} // end scell
 
             // Cell keys
-            computeParticleCellKeys( params,
-                                     particles,
-                                     &particles->cell_keys[0],
-                                     &count[0],
-                                     particles->first_index[ipack*packsize_],
-                                     particles->last_index[ipack*packsize_+packsize_-1] );
+            if( params.geometry == "3Dcartesian" && params.interpolation_order == 2
+                && !particles->is_test && mass_ > 0 ) {
+                // The projector reuses the new primal node of the particles
+                smpi->resizeProjectorNodeBuffers( ithread, nDim_field, nparts_in_pack );
+                computeParticleCellKeysAndProjectorNodes( particles,
+                                                   &particles->cell_keys[0],
+                                                   &count[0],
+                                                   particles->first_index[ipack*packsize_],
+                                                   particles->last_index[ipack*packsize_+packsize_-1],
+                                                   smpi->dynamics_projector_inew[ithread].data(),
+                                                   smpi->dynamics_projector_deltanew[ithread].data(),
+                                                   nparts_in_pack,
+                                                   particles->first_index[ipack*packsize_] );
+            } else {
+                computeParticleCellKeys( params,
+                                         particles,
+                                         &particles->cell_keys[0],
+                                         &count[0],
+                                         particles->first_index[ipack*packsize_],
+                                         particles->last_index[ipack*packsize_+packsize_-1] );
+            }
+            listMovers( ipack*packsize_, ( ipack+1 )*packsize_ );
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,11);
             //START EXCHANGE PARTICLES OF THE CURRENT BIN ?
 
@@ -496,7 +603,7 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                     particles->last_index[ipack*packsize_+scell],
                     ithread,
                     diag_flag, params.is_spectral,
-                    ispec, ipack*packsize_+scell, particles->first_index[ipack*packsize_]
+                    ispec, cellIndex( ipack*packsize_+scell ), particles->first_index[ipack*packsize_]
                 );
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,3);
 
@@ -509,6 +616,10 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
                 nrj_bc_lost += nrj_lost_per_thd[tid];
             }
         } // End loop on packs
+
+        // The sorting only needs to move the particles listed during the push
+        movers_last_index_ = particles->last_index;
+        movers_tracked_ = true;
     } //End if moving or ionized particles
 
     if(time_dual <= time_frozen_ && diag_flag &&( !particles->is_test ) ) { //immobile particle (at the moment only project density)
@@ -562,6 +673,122 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
 
 }//END dynamics
 
+// ---------------------------------------------------------------------------------------------------------------------
+// The fused dynamics is used when requested in the namelist for the common vectorized path only:
+// 3D cartesian, order 2, Boris or Vay pusher, without ionization, radiation, pair creation
+// or interpolated fields kept in the particles
+// ---------------------------------------------------------------------------------------------------------------------
+bool SpeciesV::fusedDynamicsApplies( Params &params )
+{
+    return params.fused_dynamics
+           && vectorized_operators
+           && params.geometry == "3Dcartesian"
+           && params.interpolation_order == 2
+           && ( pusher_name_ == "boris" || pusher_name_ == "vay" )
+           && !Ionize && !Radiate && !Multiphoton_Breit_Wheeler_process
+           && !particles->interpolated_fields_
+           && !particles->is_test
+           && mass_ > 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fused dynamics of one pack of particles
+// Consecutive cells are gathered in clusters of at least params.fused_chunk_size particles.
+// Each cluster goes through the interpolator, the pusher, the boundary conditions, the cell keys
+// and the projector before the next one, so that the particles and the smpi buffers of the cluster
+// (Epart, Bpart, invgf, iold, deltaold) are still in cache when they are read again.
+// The operators are the same as in the non-fused path: the results are identical.
+// ---------------------------------------------------------------------------------------------------------------------
+void SpeciesV::fusedDynamics( ElectroMagn *EMfields, Params &params, bool diag_flag,
+                              PartWalls *partWalls, Patch *patch, SmileiMPI *smpi,
+                              unsigned int ispec, int ithread, unsigned int ipack, double &nrj_lost )
+{
+    const unsigned int first_cell = ipack*packsize_;
+    const int ipart_ref = particles->first_index[first_cell];
+    const unsigned int buffer_size = particles->last_index[first_cell+packsize_-1] - ipart_ref;
+
+    // The projector reuses the new primal node of the particles
+    smpi->resizeProjectorNodeBuffers( ithread, nDim_field, buffer_size );
+
+    // Reinitialize count for sorting
+    for( unsigned int i=0; i<count.size(); i++ ) {
+        count[i] = 0;
+    }
+
+    unsigned int scell_start = 0;
+    while( scell_start < packsize_ ) {
+
+        // Cluster of consecutive cells [scell_start, scell_end[
+        unsigned int scell_end = scell_start + 1;
+        while( scell_end < packsize_
+               && ( unsigned int )( particles->last_index[first_cell+scell_end-1]
+                                    - particles->first_index[first_cell+scell_start] ) < params.fused_chunk_size ) {
+            scell_end++;
+        }
+        const int istart = particles->first_index[first_cell+scell_start];
+        const int iend   = particles->last_index[first_cell+scell_end-1];
+
+        // Interpolate the fields at the particle position
+        for( unsigned int scell = scell_start ; scell < scell_end ; scell++ ) {
+            Interp->fieldsWrapper( EMfields, *particles, smpi, &( particles->first_index[first_cell+scell] ),
+                                   &( particles->last_index[first_cell+scell] ),
+                                   ithread, scell, ipart_ref );
+        }
+
+        // Push the particles
+        ( *Push )( *particles, smpi, istart, iend, ithread, ipart_ref );
+
+        // Apply wall and boundary conditions
+        for( unsigned int scell = scell_start ; scell < scell_end ; scell++ ) {
+            double energy_lost = 0;
+            for( unsigned int iwall=0; iwall<partWalls->size(); iwall++ ) {
+                ( *partWalls )[iwall]->apply( this, particles->first_index[first_cell+scell], particles->last_index[first_cell+scell], smpi->dynamics_invgf[ithread], patch->rand_, energy_lost );
+                nrj_lost += mass_ * energy_lost;
+            }
+            partBoundCond->apply( this, particles->first_index[first_cell+scell], particles->last_index[first_cell+scell], smpi->dynamics_invgf[ithread], patch->rand_, energy_lost );
+            nrj_lost += mass_ * energy_lost;
+        }
+
+        // Cell keys and new primal node for the projector
+        computeParticleCellKeysAndProjectorNodes( particles,
+                                           &particles->cell_keys[0],
+                                           &count[0],
+                                           istart,
+                                           iend,
+                                           smpi->dynamics_projector_inew[ithread].data(),
+                                           smpi->dynamics_projector_deltanew[ithread].data(),
+                                           buffer_size,
+                                           ipart_ref );
+        listMovers( first_cell+scell_start, first_cell+scell_end );
+
+        // Project currents (and densities if a diag is needed)
+        for( unsigned int scell = scell_start ; scell < scell_end ; scell++ ) {
+            Proj->currentsAndDensityWrapper(
+                EMfields, *particles, smpi, particles->first_index[first_cell+scell],
+                particles->last_index[first_cell+scell],
+                ithread,
+                diag_flag, params.is_spectral,
+                ispec, cellIndex( first_cell+scell ), ipart_ref
+            );
+        }
+
+        scell_start = scell_end;
+    }
+}
+
+// List the particles of the bins [first_cell, end_cell[ whose new cell key differs from their bin,
+// right after the cell keys are computed
+void SpeciesV::listMovers( unsigned int first_cell, unsigned int end_cell )
+{
+    for( unsigned int icell = first_cell ; icell < end_cell ; icell++ ) {
+        for( int ip = particles->first_index[icell] ; ip < particles->last_index[icell] ; ip++ ) {
+            if( particles->cell_keys[ip] != ( int )icell ) {
+                movers_.push_back( ip );
+            }
+        }
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - increment the charge (projection)
@@ -595,13 +822,21 @@ void SpeciesV::computeCharge( ElectroMagn *EMfields, bool old /*=false*/ )
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Sort particles
+// Incremental sort: only the particles which changed cell are moved, by cycles of exchanges.
+// These particles are taken from the list made during the push when it is still valid, otherwise all the bins are scanned.
+// When the fraction of these particles exceeds params.full_sort_threshold, a full count sort is done instead.
 // ---------------------------------------------------------------------------------------------------------------------
 void SpeciesV::sortParticles( Params &params )
 {
+    //The particles listed during the push are valid if the bins did not change since then
+    const bool movers_valid = movers_tracked_ && movers_last_index_ == particles->last_index;
+    movers_tracked_ = false;
+
     unsigned int npart, ncell;
     int ip_dest, cell_target;
     vector<int> buf_cell_keys[3][2];
     std::vector<unsigned int> cycle;
+    std::vector<unsigned int> movers;
     unsigned int ip_src;
 
     //Number of dual cells
@@ -728,32 +963,86 @@ void SpeciesV::sortParticles( Params &params )
         //particles->cell_keys.resize( particles->last_index.back() ); // Merge this in particles.resize(..) ?
     }
 
-    //Loop over all cells
-    for( int icell = 0 ; icell < ( int )ncell; icell++ ) {
-        for( unsigned int ip=( unsigned int )particles->first_index[icell]; ip < ( unsigned int )particles->last_index[icell] ; ip++ ) {
-            //update value of current cell 'icell' if necessary
-            //if particle changes cell, build a cycle of exchange as long as possible. Treats all particles
-            if( particles->cell_keys[ip] != icell ) {
-                cycle.resize( 1 );
-                cycle[0] = ip;
-                ip_src = ip;
-                //While the destination particle is not going out of the patch or back to the initial cell, keep building the cycle.
-                while( particles->cell_keys[ip_src] != icell ) {
-                    //Scan the next cell destination
-                    ip_dest = particles->first_index[particles->cell_keys[ip_src]];
-                    while( particles->cell_keys[ip_dest] == particles->cell_keys[ip_src] ) {
-                        ip_dest++;
-                    }
-                    //In the destination cell, if a particle is going out of this cell, add it to the cycle.
-                    particles->first_index[particles->cell_keys[ip_src]] = ip_dest + 1 ;
-                    cycle.push_back( ip_dest );
-                    ip_src = ip_dest; //Destination becomes source for the next iteration
+    //List the particles which changed cell (the particles below first_index are already in their cell)
+    if( movers_valid ) {
+        //The cycles above only moved particles to their final place. Apart from the particles which changed cell
+        //during the push, a particle can only be out of its bin if it lies between the old and new bounds of its cell.
+        for( unsigned int icell = 0 ; icell < ncell-1; icell++ ) {
+            const int ip_min = min( movers_last_index_[icell], particles->last_index[icell] );
+            const int ip_max = min( max( movers_last_index_[icell], particles->last_index[icell] ), particles->last_index.back() );
+            for( int ip = ip_min ; ip < ip_max ; ip++ ) {
+                movers_.push_back( ip );
+            }
+        }
+        sort( movers_.begin(), movers_.end() );
+        int icell = 0;
+        for( unsigned int imover = 0 ; imover < movers_.size() ; imover++ ) {
+            const unsigned int ip = movers_[imover];
+            if( ( int )ip >= particles->last_index.back() ) {
+                break;
+            }
+            if( imover > 0 && ip == movers_[imover-1] ) {
+                continue;
+            }
+            while( ( int )ip >= particles->last_index[icell] ) {
+                icell++;
+            }
+            if( ( int )ip >= particles->first_index[icell] && particles->cell_keys[ip] != icell ) {
+                movers.push_back( ip );
+            }
+        }
+    } else {
+        for( int icell = 0 ; icell < ( int )ncell; icell++ ) {
+            for( unsigned int ip=( unsigned int )particles->first_index[icell]; ip < ( unsigned int )particles->last_index[icell] ; ip++ ) {
+                if( particles->cell_keys[ip] != icell ) {
+                    movers.push_back( ip );
                 }
-                //swap parts
-                particles->swapParticles( cycle );
             }
         }
-    } //end loop on cells
+    }
+
+    if( movers.size() > params.full_sort_threshold * particles->last_index.back() ) {
+        //Too many particles changed cell for the cycles of exchanges: full count sort.
+        //The keys of the particles already placed in their cell are not up to date.
+        for( int icell = 0 ; icell < ( int )ncell; icell++ ) {
+            for( int ip = ( icell > 0 ? particles->last_index[icell-1] : 0 ) ; ip < particles->first_index[icell] ; ip++ ) {
+                particles->cell_keys[ip] = icell;
+            }
+        }
+        countSortParticles( params );
+        return;
+    }
+
+    //Loop over the particles which changed cell
+    int icell = 0;
+    for( unsigned int imover = 0 ; imover < movers.size() ; imover++ ) {
+        const unsigned int ip = movers[imover];
+        while( ( int )ip >= particles->last_index[icell] ) {
+            icell++;
+        }
+        //Skip the particles already replaced by a previous cycle
+        if( ( int )ip < particles->first_index[icell] ) {
+            continue;
+        }
+        //build a cycle of exchange as long as possible
+        cycle.resize( 1 );
+        cycle[0] = ip;
+        ip_src = ip;
+        //While the destination particle is not going out of the patch or back to the initial cell, keep building the cycle.
+        while( particles->cell_keys[ip_src] != icell ) {
+            //Scan the next cell destination
+            ip_dest = particles->first_index[particles->cell_keys[ip_src]];
+            while( particles->cell_keys[ip_dest] == particles->cell_keys[ip_src] ) {
+                ip_dest++;
+            }
+            //In the destination cell, if a particle is going out of this cell, add it to the cycle.
+            particles->first_index[particles->cell_keys[ip_src]] = ip_dest + 1 ;
+            cycle.push_back( ip_dest );
+            ip_src = ip_dest; //Destination becomes source for the next iteration
+        }
+        //swap parts
+        particles->swapParticles( cycle );
+    } //end loop on movers
     // Restore particles->first_index initial value
     particles->first_index[0]=0;
     for( unsigned int ic=1; ic < ncell; ic++ ) {
@@ -847,6 +1136,90 @@ void SpeciesV::computeParticleCellKeys( Params    & params,
 
     }
 
+    if( !cell_rank_.empty() ) {
+        // Rank of the cell along the cell ordering
+        for( iPart=istart; iPart < iend ; iPart++  ) {
+            if ( cell_keys[iPart] >= 0 ) {
+                cell_keys[iPart] = cell_rank_[cell_keys[iPart]];
+            }
+        }
+    }
+
+    for( iPart=istart; iPart < iend ; iPart++  ) {
+        if ( cell_keys[iPart] >= 0 ) {
+            count[cell_keys[iPart]] ++;
+        }
+    }
+}
+
+// Compute particle cell_keys from istart to iend in 3D.
+// The new primal node index (relative to the patch) and the distance to this node
+// are kept in node_index and node_delta (buffers indexed from ipart_ref, of size buffer_size
+// per dimension) so that Projector3D2OrderV does not round the positions again.
+// This is a projector-only optimization: the buffers are only valid until the projection
+// of the pack, and the particles keep their absolute double positions.
+void SpeciesV::computeParticleCellKeysAndProjectorNodes( Particles * particles,
+                                                  int       * __restrict__ cell_keys,
+                                                  int       * __restrict__ count,
+                                                  unsigned int istart,
+                                                  unsigned int iend,
+                                                  int       * __restrict__ node_index,
+                                                  double    * __restrict__ node_delta,
+                                                  unsigned int buffer_size,
+                                                  unsigned int ipart_ref ) {
+
+    unsigned int iPart;
+
+    const double *const __restrict__ position_x = particles->getPtrPosition(0);
+    const double *const __restrict__ position_y = particles->getPtrPosition(1);
+    const double *const __restrict__ position_z = particles->getPtrPosition(2);
+
+    int    *const __restrict__ ix = &node_index[0];
+    int    *const __restrict__ iy = &node_index[buffer_size];
+    int    *const __restrict__ iz = &node_index[2*buffer_size];
+    double *const __restrict__ dx = &node_delta[0];
+    double *const __restrict__ dy = &node_delta[buffer_size];
+    double *const __restrict__ dz = &node_delta[2*buffer_size];
+
+    double min_loc_x = std::round (min_loc_vec[0] * dx_inv_[0]);
+    double min_loc_y = std::round (min_loc_vec[1] * dx_inv_[1]);
+    double min_loc_z = std::round (min_loc_vec[2] * dx_inv_[2]);
+
+    // Particles leaving the patch (cell_keys < 0) are still projected:
+    // their new primal node is computed as well
+    #pragma omp simd
+    for( iPart=istart; iPart < iend ; iPart++  ) {
+        const unsigned int ibuffer = iPart - ipart_ref;
+
+        double pos  = position_x[iPart] * dx_inv_[0];
+        double cell = std::round( pos );
+        ix[ibuffer] = cell - min_loc_x;
+        dx[ibuffer] = pos - cell;
+
+        pos  = position_y[iPart] * dx_inv_[1];
+        cell = std::round( pos );
+        iy[ibuffer] = cell - min_loc_y;
+        dy[ibuffer] = pos - cell;
+
+        pos  = position_z[iPart] * dx_inv_[2];
+        cell = std::round( pos );
+        iz[ibuffer] = cell - min_loc_z;
+        dz[ibuffer] = pos - cell;
+
+        if ( cell_keys[iPart] >= 0 ) {
+            cell_keys[iPart] = ( ix[ibuffer]*length_[1] + iy[ibuffer] )*length_[2] + iz[ibuffer];
+        }
+    }
+
+    if( !cell_rank_.empty() ) {
+        // Rank of the cell along the cell ordering
+        for( iPart=istart; iPart < iend ; iPart++  ) {
+            if ( cell_keys[iPart] >= 0 ) {
+                cell_keys[iPart] = cell_rank_[cell_keys[iPart]];
+            }
+        }
+    }
+
     for( iPart=istart; iPart < iend ; iPart++  ) {
         if ( cell_keys[iPart] >= 0 ) {
             count[cell_keys[iPart]] ++;
@@ -888,6 +1261,9 @@ void SpeciesV::computeParticleCellKeys( Params &params )
 
     computeParticleCellKeys( params, particles, cell_keys, &count[0], 0, npart );
 
+    // The cell keys of all the particles changed: the next sorting scans all the bins
+    movers_tracked_ = false;
+
 }
 
 void SpeciesV::importParticles( Params &params, Patch *, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I )
@@ -895,6 +1271,9 @@ void SpeciesV::importParticles( Params &params, Patch *, Particles &source_parti
 
     unsigned int npart = source_particles.size(), ncells=particles->first_index.size();
 
+    // The bins change: the next sorting scans all of them
+    movers_tracked_ = false;
+
     // If this species is tracked, set the particle IDs
     if( particles->tracked ) {
         dynamic_cast<DiagnosticTrack *>( localDiags[tracking_diagnostic] )->setIDs( source_particles );
@@ -1205,7 +1584,7 @@ void SpeciesV::ponderomotiveUpdateSusceptibilityAndMomentum( double time_dual,
 
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,3);
             for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
-                Proj->susceptibility( EMfields, *particles, mass_, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, ipack*packsize_+scell, particles->first_index[ipack*packsize_] );
+                Proj->susceptibility( EMfields, *particles, mass_, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, cellIndex( ipack*packsize_+scell ), particles->first_index[ipack*packsize_] );
             }
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,3);
 
@@ -1294,7 +1673,7 @@ void SpeciesV::ponderomotiveProjectSusceptibility( double time_dual,
             timer = MPI_Wtime();
 #endif
             for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
-                Proj->susceptibility( EMfields, *particles, mass_, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, ipack*packsize_+scell, particles->first_index[ipack*packsize_] );
+                Proj->susceptibility( EMfields, *particles, mass_, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, cellIndex( ipack*packsize_+scell ), particles->first_index[ipack*packsize_] );
             }
 
 #ifdef  __DETAILED_TIMERS
@@ -1338,6 +1717,9 @@ void SpeciesV::ponderomotiveUpdatePositionAndCurrents( double time_dual, unsigne
     int tid( 0 );
     std::vector<double> nrj_lost_per_thd( 1, 0. );
 
+    movers_.clear();
+    movers_tracked_ = false;
+
     // -------------------------------
     // calculate the particle dynamics
     // -------------------------------
@@ -1404,6 +1786,9 @@ void SpeciesV::ponderomotiveUpdatePositionAndCurrents( double time_dual, unsigne
 
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,11);
             if( mass_>0 ) { // condition mass_>0
+                // The new primal node is not stored here: the projector recomputes them
+                smpi->dynamics_projector_inew[ithread].clear();
+                smpi->dynamics_projector_deltanew[ithread].clear();
                 computeParticleCellKeys( params );
             } else if( mass_==0 ) { // condition mass_=0
                 ERROR_NAMELIST( "Particles with zero mass cannot interact with envelope",
@@ -1425,7 +1810,7 @@ void SpeciesV::ponderomotiveUpdatePositionAndCurrents( double time_dual, unsigne
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,3);
             if( ( !particles->is_test ) && ( mass_ > 0 ) )
                 for( unsigned int scell = 0 ; scell < packsize_ ; scell++ ) {
-                    Proj->currentsAndDensityWrapper( EMfields, *particles, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, diag_flag, params.is_spectral, ispec, ipack*packsize_+scell, particles->first_index[ipack*packsize_] );
+                    Proj->currentsAndDensityWrapper( EMfields, *particles, smpi, particles->first_index[ipack*packsize_+scell], particles->last_index[ipack*packsize_+scell], ithread, diag_flag, params.is_spectral, ispec, cellIndex( ipack*packsize_+scell ), particles->first_index[ipack*packsize_] );
                 }
             smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,3);
 
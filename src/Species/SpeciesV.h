@@ -74,6 +74,19 @@ public:
     //! Compute cell_keys for all particles of the current species
     void computeParticleCellKeys( Params &params ) override;
 
+    //! Compute cell_keys from istart to iend in 3D, and store the new primal node of the particles
+    //! and their distance to this node, for Projector3D2OrderV only (scratch buffers of the step,
+    //! the particle positions remain absolute double coordinates)
+    void computeParticleCellKeysAndProjectorNodes( Particles * particles,
+                                            int       * __restrict__ cell_keys,
+                                            int       * __restrict__ count,
+                                            unsigned int istart,
+                                            unsigned int iend,
+                                            int       * __restrict__ node_index,
+                                            double    * __restrict__ node_delta,
+                                            unsigned int buffer_size,
+                                            unsigned int ipart_ref );
+
     //! Create a new entry for a particle
     void addSpaceForOneParticle() override
     {
@@ -86,9 +99,42 @@ public:
     //! Method performing the merging of particles
     virtual void mergeParticles( double time_dual )override;
 
+    //! Row-major index of the cell of the bin icell (the cell index expected by the operators)
+    inline int cellIndex( unsigned int icell ) const
+    {
+        return ranked_cell_.empty() ? icell : ranked_cell_[icell];
+    }
+
 
 private:
 
+    //! Rank the cells of the patch along the curve chosen by Vectorization.cell_ordering
+    void initCellOrdering( Params &params );
+
+    //! Rank of each cell (row-major index) along the cell ordering, empty for the row-major order
+    std::vector<int> cell_rank_;
+    //! Row-major index of the cell of each rank (inverse of cell_rank_)
+    std::vector<int> ranked_cell_;
+
+    //! True if the interpolation, push and projection of this species can be fused (see fusedDynamics)
+    bool fusedDynamicsApplies( Params &params );
+
+    //! Interpolation, push, boundary conditions, cell keys and projection of the pack ipack,
+    //! processed together per cluster of consecutive cells (3D, order 2, Boris or Vay pusher)
+    void fusedDynamics( ElectroMagn *EMfields, Params &params, bool diag_flag,
+                        PartWalls *partWalls, Patch *patch, SmileiMPI *smpi,
+                        unsigned int ispec, int ithread, unsigned int ipack, double &nrj_lost );
+
+    //! List the particles of the bins [first_cell, end_cell[ whose new cell key differs from their bin
+    void listMovers( unsigned int first_cell, unsigned int end_cell );
+
+    //! Particles which changed cell during the last push, listed right after their cell keys
+    std::vector<unsigned int> movers_;
+    //! Bins of the particles when movers_ was listed, to check that they did not change before the sorting
+    std::vector<int> movers_last_index_;
+    //! True if movers_ lists all the particles which changed cell since the last sorting
+    bool movers_tracked_;
+
     //! Number of packs of particles that divides the total number of particles
     unsigned int npack_;
     //! Size of the pack in number of particles
@@ -1,12 +1,18 @@
 #include "H5.h"
 #include <iomanip>
+#include <algorithm>
 
 //! Open HDF5 file + location
-H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
+H5::H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise ) : image_( NULL )
 {
     init( file, access, comm, _raise );
 }
 
+H5::H5( std::string file, std::vector<char> * image ) : image_( image )
+{
+    init( file, H5F_ACC_RDWR, NULL, true );
+}
+
 void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
 {
     
@@ -40,6 +46,9 @@ void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
     hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
     if( comm ) {
         H5Pset_fapl_mpio( fapl, *comm, MPI_INFO_NULL );
+    } else if( image_ ) {
+        // In-memory file grown by 16 MB increments, without backing store
+        H5Pset_fapl_core( fapl, 1<<24, false );
     }
     if( access == H5F_ACC_RDWR ) {
         fid_ = H5Fcreate( filepath_.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl );
@@ -85,8 +94,111 @@ void H5::init( std::string file, unsigned access, MPI_Comm * comm, bool _raise )
 
 
 //! Location already opened
-H5::H5( hid_t id, hid_t dcr, hid_t dxpl ) : fid_( -1 ), id_( id ), dcr_( dcr ), dxpl_( dxpl )
+H5::H5( hid_t id, hid_t dcr, hid_t dxpl ) : fid_( -1 ), id_( id ), dcr_( dcr ), dxpl_( dxpl ), image_( NULL )
+{
+}
+
+static herr_t appendLinkName( hid_t, const char *name, const H5L_info_t *, void *names )
+{
+    static_cast<std::vector<std::string> *>( names )->push_back( name );
+    return 0;
+}
+
+std::vector<std::string> H5::links()
+{
+    std::vector<std::string> names;
+    H5Literate( id_, H5_INDEX_NAME, H5_ITER_INC, NULL, appendLinkName, &names );
+    return names;
+}
+
+static herr_t appendExternalFile( hid_t loc, const char *name, const H5L_info_t *info, void *files )
+{
+    if( info->type != H5L_TYPE_EXTERNAL ) {
+        return 0;
+    }
+    std::vector<char> value( info->u.val_size );
+    unsigned flags;
+    const char *file, *object;
+    if( H5Lget_val( loc, name, &value[0], value.size(), H5P_DEFAULT ) >= 0
+        && H5Lunpack_elink_val( &value[0], value.size(), &flags, &file, &object ) >= 0 ) {
+        std::vector<std::string> *names = static_cast<std::vector<std::string> *>( files );
+        if( std::find( names->begin(), names->end(), file ) == names->end() ) {
+            names->push_back( file );
+        }
+    }
+    return 0;
+}
+
+std::vector<std::string> H5::externalFiles()
 {
+    std::vector<std::string> files;
+    H5Lvisit( id_, H5_INDEX_NAME, H5_ITER_NATIVE, appendExternalFile, &files );
+    return files;
+}
+
+hid_t H5::datasetCreation( std::vector<hsize_t> chunk )
+{
+    hid_t dcr = H5Pcopy( dcr_ );
+    if( ! chunk.empty() ) {
+        H5Pset_chunk( dcr, chunk.size(), &chunk[0] );
+        if( H5Pget_nfilters( dcr ) > 0 ) {
+            // Filtered chunks cannot be left unwritten
+            H5Pset_fill_time( dcr, H5D_FILL_TIME_IFSET );
+        }
+    } else if( H5Pget_nfilters( dcr ) > 0 ) {
+        H5Premove_filter( dcr, H5Z_FILTER_ALL );
+    }
+    return dcr;
+}
+
+void H5Write::compression( std::string compressor, int level )
+{
+    if( H5Pget_nfilters( dcr_ ) > 0 ) {
+        H5Premove_filter( dcr_, H5Z_FILTER_ALL );
+    }
+    // Shuffling the bytes of the numbers groups their exponents, which compress well
+    H5Pset_shuffle( dcr_ );
+    if( compressor == "zstd" && H5Zfilter_avail( H5Z_FILTER_ZSTD ) > 0 ) {
+        unsigned int cd_values[1] = { ( unsigned int ) std::max( 0, level ) };
+        H5Pset_filter( dcr_, H5Z_FILTER_ZSTD, H5Z_FLAG_OPTIONAL, 1, cd_values );
+    } else if( compressor == "lz4" && H5Zfilter_avail( H5Z_FILTER_LZ4 ) > 0 ) {
+        H5Pset_filter( dcr_, H5Z_FILTER_LZ4, H5Z_FLAG_OPTIONAL, 0, NULL );
+    } else {
+        if( compressor != "deflate" ) {
+            static bool warned = false;
+            if( ! warned ) {
+                WARNING( "HDF5 filter " << compressor << " not found (see HDF5_PLUGIN_PATH): using deflate instead" );
+                warned = true;
+            }
+        }
+        H5Pset_deflate( dcr_, std::min( 9, std::max( 1, level ) ) );
+    }
+}
+
+static herr_t addStorageSize( hid_t loc, const char *name, const H5L_info_t *info, void *sizes )
+{
+    if( info->type != H5L_TYPE_HARD ) {
+        return 0;
+    }
+    hid_t oid = H5Oopen( loc, name, H5P_DEFAULT );
+    if( H5Iget_type( oid ) == H5I_DATASET ) {
+        hid_t sid = H5Dget_space( oid );
+        hid_t tid = H5Dget_type( oid );
+        static_cast<hsize_t *>( sizes )[0] += H5Sget_simple_extent_npoints( sid ) * H5Tget_size( tid );
+        static_cast<hsize_t *>( sizes )[1] += H5Dget_storage_size( oid );
+        H5Tclose( tid );
+        H5Sclose( sid );
+    }
+    H5Oclose( oid );
+    return 0;
+}
+
+void H5Write::storageSize( hsize_t &raw, hsize_t &stored )
+{
+    hsize_t sizes[2] = { 0, 0 };
+    H5Lvisit( id_, H5_INDEX_NAME, H5_ITER_NATIVE, addStorageSize, sizes );
+    raw = sizes[0];
+    stored = sizes[1];
 }
 
 H5::~H5()
@@ -99,6 +211,15 @@ H5::~H5()
     if( fid_ >= 0 ) {
         H5Pclose( dxpl_ );
         H5Pclose( dcr_ );
+        if( image_ ) {
+            H5Fflush( fid_, H5F_SCOPE_GLOBAL );
+            ssize_t size = H5Fget_file_image( fid_, NULL, 0 );
+            image_->resize( size > 0 ? size : 0 );
+            if( size <= 0 || H5Fget_file_image( fid_, image_->data(), size ) != size ) {
+                H5Eprint2( H5E_DEFAULT, NULL );
+                ERROR( "Can't copy the image of file " << filepath_ );
+            }
+        }
         herr_t err = H5Fclose( fid_ );
         if( err < 0 ) {
             H5Eprint2( H5E_DEFAULT, NULL );
@@ -11,6 +11,14 @@
 #error "HDF5 was not built with --enable-parallel option"
 #endif
 
+// Identifiers registered by The HDF Group for the LZ4 and Zstandard filters (provided by HDF5 plugins)
+#ifndef H5Z_FILTER_LZ4
+#define H5Z_FILTER_LZ4 32004
+#endif
+#ifndef H5Z_FILTER_ZSTD
+#define H5Z_FILTER_ZSTD 32015
+#endif
+
 class DividedString
 {
 public:
@@ -68,11 +76,15 @@ public:
         id_ = -1;
         dxpl_ = -1;
         dcr_ = -1;
+        image_ = NULL;
     };
     
     //! Open HDF5 file + location
     H5( std::string file, unsigned access, MPI_Comm * comm, bool _raise );
     
+    //! Create HDF5 file in memory, copied in `image` when closed
+    H5( std::string file, std::vector<char> * image );
+    
     ~H5();
     
     void init( std::string file, unsigned access, MPI_Comm * comm, bool _raise );
@@ -97,6 +109,12 @@ public:
         return H5Aexists( id_, attribute_name.c_str() ) > 0;
     }
     
+    //! Names of the groups and datasets at this location
+    std::vector<std::string> links();
+    
+    //! Files targeted by the external links found at this location and in its groups
+    std::vector<std::string> externalFiles();
+    
 protected:
     //! Constructor when location already opened
     H5( hid_t ID, hid_t dcr, hid_t dxpl );
@@ -106,6 +124,7 @@ protected:
     hid_t id_;
     hid_t dcr_;
     hid_t dxpl_;
+    std::vector<char> * image_; // only defined if the file is in memory
     
     hid_t newGroupId( std::string group_name ) {
         if( H5Lexists( id_, group_name.c_str(), H5P_DEFAULT ) > 0 ) {
@@ -115,6 +134,9 @@ protected:
         }
     }
     
+    //! Properties to create a chunked dataset (compression filters are dropped without chunks)
+    hid_t datasetCreation( std::vector<hsize_t> chunk );
+    
     hid_t open( std::string name ) {
         if( H5Lexists( id_, name.c_str(), H5P_DEFAULT ) > 0 ) {
             return H5Oopen( id_, name.c_str(), H5P_DEFAULT );
@@ -132,6 +154,10 @@ public:
     H5Write( std::string file, MPI_Comm * comm = NULL, bool _raise = true )
      : H5( file, H5F_ACC_RDWR, comm, _raise ) {};
     
+    //! Create HDF5 file in memory: nothing is written on disk, the file image is copied in `image` when closed
+    H5Write( std::string file, std::vector<char> * image )
+     : H5( file, image ) {};
+    
     //! Create group inside the given H5Write location
     H5Write( H5Write *loc, std::string group_name )
      : H5( loc->newGroupId( group_name ), loc->dcr_, loc->dxpl_ ) {};
@@ -140,18 +166,15 @@ public:
     H5Write( H5Write *loc, std::string name, hid_t type, H5Space *filespace )
      : H5( -1, loc->dcr_, loc->dxpl_ )
     {
-        H5D_layout_t layout = H5Pget_layout( dcr_ );
-        if( ! filespace->chunk_.empty() ) {
-            H5Pset_chunk( dcr_, filespace->chunk_.size(), &filespace->chunk_[0] );
-        }
         if( H5Lexists( loc->id_, name.c_str(), H5P_DEFAULT ) == 0 ) {
-            id_  = H5Dcreate( loc->id_, name.c_str(), type, filespace->sid_, H5P_DEFAULT, dcr_, H5P_DEFAULT );
+            hid_t dcr = datasetCreation( filespace->chunk_ );
+            id_  = H5Dcreate( loc->id_, name.c_str(), type, filespace->sid_, H5P_DEFAULT, dcr, H5P_DEFAULT );
+            H5Pclose( dcr );
         } else {
             hid_t pid = H5Pcreate( H5P_DATASET_ACCESS );
             id_ = H5Dopen( loc->id_, name.c_str(), pid );
             H5Pclose( pid );
         }
-        H5Pset_layout( dcr_, layout );
     }
     
     //! Location already opened
@@ -165,6 +188,21 @@ public:
         return H5Write( this, group_name );
     }
     
+    //! Compress the datasets created from now on at this location and in its groups: shuffle, then
+    //! `compressor` ("zstd" or "lz4" when their HDF5 plugin is found, "deflate" otherwise) at the given level
+    void compression( std::string compressor, int level );
+    
+    //! Total size of the datasets of the file, uncompressed and as stored (external links are not followed)
+    void storageSize( hsize_t &raw, hsize_t &stored );
+    
+    //! Link to an object of another file (a relative file name is searched in the directory of this file)
+    void externalLink( std::string name, std::string file, std::string object )
+    {
+        if( H5Lcreate_external( file.c_str(), object.c_str(), id_, name.c_str(), H5P_DEFAULT, H5P_DEFAULT ) < 0 ) {
+            ERROR( "Cannot link " << name << " to " << file << ":" << object );
+        }
+    }
+    
     //! Write a string as an attribute
     void attr( std::string attribute_name, std::string attribute_value )
     {
@@ -308,12 +346,6 @@ public:
     {
         // create dataspace for 1D array with good number of elements
         hsize_t dim = size;
-//        if( deflate>0 ) {
-//            H5Pset_chunk( dcr_, 1, &dim );
-//            H5Pset_deflate( dcr_, std::min( 9, deflate ) );
-//        } else {
-//            H5Premove_filter( dcr_, H5Z_FILTER_DEFLATE );
-//        }
         // Select portion
         if( npoints == 0 ) {
             npoints = dim - offset;
@@ -326,8 +358,15 @@ public:
             hsize_t n = npoints;
             H5Sselect_hyperslab( filespace, H5S_SELECT_SET, &o, NULL, &c, &n );
         }
-        // create dataset
-        hid_t did = H5Dcreate( id_, name.c_str(), type, filespace, H5P_DEFAULT, dcr_, H5P_DEFAULT );
+        // create dataset (compressed in chunks of at most 2^20 points)
+        hid_t dcr = dcr_;
+        if( H5Pget_nfilters( dcr_ ) > 0 ) {
+            dcr = datasetCreation( std::vector<hsize_t>( dim > 0 ? 1 : 0, std::min( dim, ( hsize_t )1<<20 ) ) );
+        }
+        hid_t did = H5Dcreate( id_, name.c_str(), type, filespace, H5P_DEFAULT, dcr, H5P_DEFAULT );
+        if( dcr != dcr_ ) {
+            H5Pclose( dcr );
+        }
         // write vector in dataset
         H5Dwrite( did, type, memspace, filespace, dxpl_, &v );
         // close all
@@ -0,0 +1,156 @@
+#ifndef SMILEI_TOOLS_SIMD_H
+#define SMILEI_TOOLS_SIMD_H
+
+#if defined( __AVX512F__ ) || defined( __AVX2__ )
+#include <immintrin.h>
+#endif
+
+namespace smilei {
+    namespace tools {
+        namespace simd {
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // Explicit SIMD vectors of doubles
+            ////////////////////////////////////////////////////////////////////////////////
+
+            /// Thin wrappers around the SIMD registers, used by the explicit-SIMD kernels
+            /// (config=simd_kernels). `Vector` is the widest type allowed by the compiler
+            /// flags (-mavx512f, -mavx2, -march=...):
+            ///  - AVX-512: 8 doubles per vector
+            ///  - AVX2   : 4 doubles per vector
+            ///  - Scalar : 1 double per vector, on any other target (and for the remainder of the loops)
+            ///
+            /// Only plain multiplications and additions are provided (no fused multiply-add): the kernels
+            /// do the operations in the same order as the `#pragma omp simd` kernels, and give the same
+            /// results, up to the round-off of the multiply-adds contracted by the compiler in the latter.
+
+            struct Scalar
+            {
+                static const int width = 1;
+                typedef bool Mask;
+                double v;
+
+                Scalar() {}
+                explicit Scalar( double a ) : v( a ) {}
+
+                static inline Scalar load( const double *p )
+                {
+                    return Scalar( *p );
+                }
+                inline void store( double *p ) const
+                {
+                    *p = v;
+                }
+                //! Lanes where the integer flags are non zero
+                static inline Mask nonZero( const int *p )
+                {
+                    return *p != 0;
+                }
+                //! b in the lanes of the mask, a elsewhere
+                static inline Scalar select( Mask mask, Scalar a, Scalar b )
+                {
+                    return mask ? b : a;
+                }
+                static inline const char *name()
+                {
+                    return "scalar";
+                }
+            };
+
+            inline Scalar operator+( Scalar a, Scalar b ) { return Scalar( a.v + b.v ); }
+            inline Scalar operator-( Scalar a, Scalar b ) { return Scalar( a.v - b.v ); }
+            inline Scalar operator*( Scalar a, Scalar b ) { return Scalar( a.v * b.v ); }
+
+#if defined( __AVX512F__ )
+
+            struct Avx512
+            {
+                static const int width = 8;
+                typedef __mmask8 Mask;
+                __m512d v;
+
+                Avx512() {}
+                Avx512( __m512d a ) : v( a ) {}
+                explicit Avx512( double a ) : v( _mm512_set1_pd( a ) ) {}
+
+                static inline Avx512 load( const double *p )
+                {
+                    return Avx512( _mm512_loadu_pd( p ) );
+                }
+                inline void store( double *p ) const
+                {
+                    _mm512_storeu_pd( p, v );
+                }
+                static inline Mask nonZero( const int *p )
+                {
+                    const __m512i flags = _mm512_maskz_cvtepi32_epi64( 0xFF, _mm256_loadu_si256( reinterpret_cast<const __m256i *>( p ) ) );
+                    return _mm512_test_epi64_mask( flags, flags );
+                }
+                static inline Avx512 select( Mask mask, Avx512 a, Avx512 b )
+                {
+                    return Avx512( _mm512_mask_blend_pd( mask, a.v, b.v ) );
+                }
+                static inline const char *name()
+                {
+                    return "AVX-512";
+                }
+            };
+
+            inline Avx512 operator+( Avx512 a, Avx512 b ) { return Avx512( _mm512_add_pd( a.v, b.v ) ); }
+            inline Avx512 operator-( Avx512 a, Avx512 b ) { return Avx512( _mm512_sub_pd( a.v, b.v ) ); }
+            inline Avx512 operator*( Avx512 a, Avx512 b ) { return Avx512( _mm512_mul_pd( a.v, b.v ) ); }
+
+            typedef Avx512 Vector;
+
+#elif defined( __AVX2__ )
+
+            struct Avx2
+            {
+                static const int width = 4;
+                typedef __m256d Mask;
+                __m256d v;
+
+                Avx2() {}
+                Avx2( __m256d a ) : v( a ) {}
+                explicit Avx2( double a ) : v( _mm256_set1_pd( a ) ) {}
+
+                static inline Avx2 load( const double *p )
+                {
+                    return Avx2( _mm256_loadu_pd( p ) );
+                }
+                inline void store( double *p ) const
+                {
+                    _mm256_storeu_pd( p, v );
+                }
+                static inline Mask nonZero( const int *p )
+                {
+                    const __m256d flags = _mm256_cvtepi32_pd( _mm_loadu_si128( reinterpret_cast<const __m128i *>( p ) ) );
+                    return _mm256_cmp_pd( flags, _mm256_setzero_pd(), _CMP_NEQ_OQ );
+                }
+                static inline Avx2 select( Mask mask, Avx2 a, Avx2 b )
+                {
+                    return Avx2( _mm256_blendv_pd( a.v, b.v, mask ) );
+                }
+                static inline const char *name()
+                {
+                    return "AVX2";
+                }
+            };
+
+            inline Avx2 operator+( Avx2 a, Avx2 b ) { return Avx2( _mm256_add_pd( a.v, b.v ) ); }
+            inline Avx2 operator-( Avx2 a, Avx2 b ) { return Avx2( _mm256_sub_pd( a.v, b.v ) ); }
+            inline Avx2 operator*( Avx2 a, Avx2 b ) { return Avx2( _mm256_mul_pd( a.v, b.v ) ); }
+
+            typedef Avx2 Vector;
+
+#else
+
+            typedef Scalar Vector;
+
+#endif
+
+        } // namespace simd
+    } // namespace tools
+} // namespace smilei
+
+#endif
@@ -0,0 +1,374 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//! Main.cpp for the tool smilei_kernel_bench
+//! This tool times the particle operators (interpolator, pusher, projector) and the cell sorting
+//! in isolation, on a single core.
+//! The operators are created by InterpolatorFactory, PusherFactory and ProjectorFactory from a namelist,
+//! as in Smilei, for the particles of a single patch and synthetic electromagnetic fields.
+//! The operator variants are selected by the namelist (geometry, interpolation order, vectorization),
+//! all the pushers compatible with each species are timed.
+// ---------------------------------------------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <omp.h>
+#if defined( __GNUG__ )
+#include <cxxabi.h>
+#endif
+
+#include "SmileiMPI.h"
+#include "Params.h"
+#include "OpenPMDparams.h"
+#include "VectorPatch.h"
+#include "PatchesFactory.h"
+#include "RadiationTables.h"
+#include "SimWindow.h"
+#include "ElectroMagn.h"
+#include "Field.h"
+#include "Species.h"
+#include "SpeciesV.h"
+#include "Particles.h"
+#include "InterpolatorFactory.h"
+#include "PusherFactory.h"
+#include "ProjectorFactory.h"
+#include "Tools.h"
+
+using namespace std;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tools
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Name of the class of an operator (the factory variant)
+template<typename T>
+string className( const T &object )
+{
+    string name = typeid( object ).name();
+#if defined( __GNUG__ )
+    int status = 0;
+    char *demangled = abi::__cxa_demangle( name.c_str(), nullptr, nullptr, &status );
+    if( status == 0 ) {
+        name = demangled;
+    }
+    free( demangled );
+#endif
+    return name;
+}
+
+//! Smooth synthetic values for the fields seen by the particles
+void fillField( Field *field, double amplitude, double phase )
+{
+    if( !field ) {
+        return;
+    }
+    for( unsigned int i=0 ; i<field->number_of_points_ ; i++ ) {
+        field->data_[i] = amplitude * sin( 0.37*i + phase );
+    }
+}
+
+//! Positions and momenta of the particles, restored before each repetition so that
+//! the particles never move by more than one timestep (as in a real time step)
+class ParticlesState
+{
+public:
+    void save( Particles &particles )
+    {
+        position_ = particles.Position;
+        momentum_ = particles.Momentum;
+    }
+    void restore( Particles &particles )
+    {
+        for( unsigned int i=0 ; i<position_.size() ; i++ ) {
+            copy( position_[i].begin(), position_[i].end(), particles.Position[i].begin() );
+        }
+        for( unsigned int i=0 ; i<momentum_.size() ; i++ ) {
+            copy( momentum_[i].begin(), momentum_[i].end(), particles.Momentum[i].begin() );
+        }
+    }
+private:
+    vector< vector<double> > position_;
+    vector< vector<double> > momentum_;
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Operators called as in Species::dynamics and SpeciesV::dynamics (a single pack of cells for SpeciesV)
+// ---------------------------------------------------------------------------------------------------------------------
+
+void interpolate( Interpolator *Interp, Species *species, ElectroMagn *EMfields, SmileiMPI *smpi )
+{
+    Particles &particles = *species->particles;
+    for( unsigned int ibin = 0 ; ibin < particles.first_index.size() ; ibin++ ) {
+        if( species->vectorized_operators ) {
+            Interp->fieldsWrapper( EMfields, particles, smpi, &( particles.first_index[ibin] ), &( particles.last_index[ibin] ),
+                                   0, ibin, particles.first_index[0] );
+        } else {
+            Interp->fieldsWrapper( EMfields, particles, smpi, &( particles.first_index[ibin] ), &( particles.last_index[ibin] ), 0 );
+        }
+    }
+}
+
+void push( Pusher *Push, Species *species, SmileiMPI *smpi )
+{
+    Particles &particles = *species->particles;
+    ( *Push )( particles, smpi, 0, particles.last_index.back(), 0, particles.first_index[0] );
+}
+
+void project( Projector *Proj, Species *species, ElectroMagn *EMfields, SmileiMPI *smpi, Params &params, unsigned int ispec )
+{
+    Particles &particles = *species->particles;
+    for( unsigned int ibin = 0 ; ibin < particles.first_index.size() ; ibin++ ) {
+        if( species->vectorized_operators ) {
+            Proj->currentsAndDensityWrapper( EMfields, particles, smpi, particles.first_index[ibin], particles.last_index[ibin],
+                                             0, false, params.is_spectral, ispec, ibin, particles.first_index[0] );
+        } else {
+            Proj->currentsAndDensityWrapper( EMfields, particles, smpi, particles.first_index[ibin], particles.last_index[ibin],
+                                             0, false, params.is_spectral, ispec );
+        }
+    }
+}
+
+//! Moves a fraction of the particles by one cell along x (periodically in the patch), as between two sorts
+void moveParticles( Species *species, Patch *patch, Params &params, double fraction, unsigned int seed )
+{
+    Particles &particles = *species->particles;
+    const double xmin = patch->getDomainLocalMin( 0 );
+    const double length = patch->getDomainLocalMax( 0 ) - xmin;
+    const unsigned int threshold = fraction * 1000;
+    for( unsigned int ip = 0 ; ip < particles.numberOfParticles() ; ip++ ) {
+        if( ( ip * 7919u + seed * 104729u ) % 1000 < threshold ) {
+            double &x = particles.position( 0, ip );
+            x += params.cell_length[0];
+            if( x >= xmin + length ) {
+                x -= length;
+            }
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Report
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Particle data read and written by each operator, in bytes per particle (estimate, the grid is not counted)
+struct ParticleBytes {
+    ParticleBytes( Params &params, bool mixed_precision )
+    {
+        const double position = params.nDim_particle * sizeof( double );
+        const double momentum = 3 * sizeof( double );
+        const double fields   = 6 * ( mixed_precision ? sizeof( float ) : sizeof( double ) );
+        const double old      = params.nDim_field * ( sizeof( int ) + sizeof( double ) );
+        // positions -> fields, iold, deltaold
+        interpolator = position + fields + old;
+        // positions, momenta, charge, fields -> positions, momenta, invgf
+        pusher = 2*( position + momentum ) + sizeof( short ) + fields + sizeof( double );
+        // positions, momenta, weight, charge, invgf, iold, deltaold
+        projector = position + momentum + sizeof( double ) + sizeof( short ) + sizeof( double ) + old;
+        // one particle: positions, momenta, weight, charge, cell key
+        sort = position + momentum + sizeof( double ) + sizeof( short ) + sizeof( int );
+    }
+    double interpolator, pusher, projector, sort;
+};
+
+void printResult( const string &kernel, const string &variant, double seconds, unsigned int repetitions, unsigned int nparticles, double bytes )
+{
+    const double particles_per_second = seconds > 0. ? ( double )repetitions * nparticles / seconds : 0.;
+    cout << "   " << left << setw( 14 ) << kernel << setw( 42 ) << variant << right
+         << scientific << setprecision( 3 ) << setw( 12 ) << particles_per_second << " particles/s"
+         << fixed << setprecision( 0 ) << setw( 8 ) << bytes << " bytes/particle"
+         << scientific << setprecision( 3 ) << setw( 12 ) << bytes * particles_per_second * 1e-9 << " GB/s" << endl;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------------------------------------------------
+
+int main( int argc, char *argv[] )
+{
+    string help_message;
+    help_message =  "\n This tool times the interpolators, pushers, projectors and cell sorting of Smilei on a single core.\n";
+    help_message += " Usage: smilei_kernel_bench [-r repetitions] namelist(s)\n";
+    help_message += " The namelists are given as for smilei, for instance:\n";
+    help_message += "   smilei_kernel_bench \"geometry='2Dcartesian'\" tools/kernel_bench/kernel_bench.py\n";
+    help_message += " List of available commands:\n";
+    help_message += " -h              print a help message and exit.\n";
+    help_message += " -r repetitions  number of calls of each operator (default 20).\n";
+
+    // Command line: options of the tool, then the namelists
+    unsigned int repetitions = 20;
+    vector<string> namelists;
+    for( int i = 1 ; i < argc ; i++ ) {
+        const string argument( argv[i] );
+        if( argument == "-h" ) {
+            cout << help_message << endl;
+            return 0;
+        } else if( argument == "-r" && i+1 < argc ) {
+            repetitions = atoi( argv[++i] );
+        } else {
+            namelists.push_back( argument );
+        }
+    }
+    if( namelists.empty() ) {
+        cout << help_message << endl;
+        return 1;
+    }
+
+    // Single core
+#ifdef _OMP
+    omp_set_num_threads( 1 );
+#endif
+
+    // Same initialization as Smilei (singleton MPI, no launcher needed)
+    SmileiMPI smpi( &argc, &argv );
+    if( smpi.getSize() > 1 ) {
+        ERROR( "smilei_kernel_bench runs on a single MPI process" );
+    }
+
+    TITLE( "Reading the simulation parameters" );
+    Params params( &smpi, namelists );
+    OpenPMDparams openPMD( params );
+    PyTools::setIteration( 0 );
+
+    if( params.geometry == "AMcylindrical" ) {
+        ERROR( "smilei_kernel_bench only supports the cartesian geometries" );
+    }
+
+    VectorPatch vecPatches( params );
+    smpi.init( params, vecPatches.domain_decomposition_ );
+    SimWindow simWindow( params );
+    RadiationTables radiation_tables;
+
+    TITLE( "Creating the patch" );
+    PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables, 0 );
+    vecPatches.initialParticleSorting( params );
+    if( vecPatches.size() != 1 ) {
+        ERROR( "smilei_kernel_bench requires a single patch (number_of_patches = [1, ...])" );
+    }
+
+    Patch *patch = vecPatches( 0 );
+    ElectroMagn *EMfields = patch->EMfields;
+    fillField( EMfields->Ex_, 0.05, 0.0 );
+    fillField( EMfields->Ey_, 0.05, 1.0 );
+    fillField( EMfields->Ez_, 0.05, 2.0 );
+    fillField( EMfields->Bx_m, 0.05, 3.0 );
+    fillField( EMfields->By_m, 0.05, 4.0 );
+    fillField( EMfields->Bz_m, 0.05, 5.0 );
+    fillField( EMfields->By_mBTIS3, 0.05, 4.0 );
+    fillField( EMfields->Bz_mBTIS3, 0.05, 5.0 );
+
+    cout << "\n Kernel benchmark: " << params.geometry << ", order " << params.interpolation_order
+         << ", " << repetitions << " repetitions\n" << endl;
+
+    for( unsigned int ispec = 0 ; ispec < patch->vecSpecies.size() ; ispec++ ) {
+        Species *species = patch->vecSpecies[ispec];
+        Particles &particles = *species->particles;
+        const unsigned int nparticles = particles.numberOfParticles();
+        if( nparticles == 0 ) {
+            continue;
+        }
+
+        cout << " Species " << species->name_ << ": " << nparticles << " particles, "
+             << ( species->vectorized_operators ? "vectorized" : "scalar" ) << " operators"
+             << ( species->mixed_precision_ ? ", mixed precision" : "" ) << endl;
+
+        smpi.resizeBuffers( 0, params.nDim_field, nparticles, false, species->mixed_precision_ );
+
+        ParticlesState state;
+        state.save( particles );
+        const ParticleBytes bytes( params, species->mixed_precision_ );
+
+        // Interpolator
+        Interpolator *Interp = InterpolatorFactory::create( params, patch, species->vectorized_operators, species->mixed_precision_ );
+        interpolate( Interp, species, EMfields, &smpi );
+        double time = 0.;
+        for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+            const double t0 = MPI_Wtime();
+            interpolate( Interp, species, EMfields, &smpi );
+            time += MPI_Wtime() - t0;
+        }
+        printResult( "Interpolator", className( *Interp ), time, repetitions, nparticles, bytes.interpolator );
+
+        // Pushers: all those compatible with the species (the interpolated fields stay in the buffers)
+        vector<string> pushers;
+        if( species->mass_ == 0 ) {
+            pushers.push_back( "norm" );
+        } else if( species->mixed_precision_ ) {
+            pushers.push_back( "boris" );
+            pushers.push_back( "vay" );
+        } else {
+            pushers.push_back( "boris" );
+            pushers.push_back( "borisnr" );
+            pushers.push_back( "vay" );
+            pushers.push_back( "higueracary" );
+            if( params.use_BTIS3 ) {
+                pushers.push_back( "borisBTIS3" );
+            }
+        }
+        const string pusher_name = species->pusher_name_;
+        for( unsigned int ipush = 0 ; ipush < pushers.size() ; ipush++ ) {
+            species->pusher_name_ = pushers[ipush];
+            Pusher *Push = PusherFactory::create( params, species );
+            time = 0.;
+            for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+                state.restore( particles );
+                const double t0 = MPI_Wtime();
+                push( Push, species, &smpi );
+                time += MPI_Wtime() - t0;
+            }
+            printResult( "Pusher", className( *Push ), time, repetitions, nparticles, bytes.pusher );
+            delete Push;
+        }
+        species->pusher_name_ = pusher_name;
+
+        // Projector: particles pushed by the pusher of the species, then projected from the same state
+        if( species->mass_ > 0 && !particles.is_test ) {
+            Projector *Proj = ProjectorFactory::create( params, patch, species->vectorized_operators );
+            state.restore( particles );
+            push( species->Push, species, &smpi );
+            time = 0.;
+            for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+                const double t0 = MPI_Wtime();
+                project( Proj, species, EMfields, &smpi, params, ispec );
+                time += MPI_Wtime() - t0;
+            }
+            printResult( "Projector", className( *Proj ), time, repetitions, nparticles, bytes.projector );
+            delete Proj;
+        }
+
+        // Cell sorting: incremental and full count sort, for several fractions of particles changing cell
+        SpeciesV *speciesV = dynamic_cast<SpeciesV *>( species );
+        if( speciesV && params.cell_sorting_ ) {
+            const double full_sort_threshold = params.full_sort_threshold;
+            const double fractions[4] = { 0.01, 0.1, 0.3, 0.6 };
+            for( unsigned int ifraction = 0 ; ifraction < 4 ; ifraction++ ) {
+                for( unsigned int full = 0 ; full < 2 ; full++ ) {
+                    params.full_sort_threshold = full ? 0. : 1.;
+                    time = 0.;
+                    for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+                        moveParticles( species, patch, params, fractions[ifraction], irep );
+                        speciesV->computeParticleCellKeys( params );
+                        const double t0 = MPI_Wtime();
+                        speciesV->sortParticles( params );
+                        time += MPI_Wtime() - t0;
+                    }
+                    ostringstream variant;
+                    variant << ( full ? "count sort, " : "incremental, " ) << fractions[ifraction]*100. << "% moved";
+                    printResult( "Sort", variant.str(), time, repetitions, nparticles, bytes.sort );
+                }
+            }
+            params.full_sort_threshold = full_sort_threshold;
+        }
+
+        state.restore( particles );
+        delete Interp;
+        cout << endl;
+    }
+
+    vecPatches.close( &smpi );
+    smpi.barrier();
+    return 0;
+}
@@ -0,0 +1,75 @@
+# ----------------------------------------------------------------------------------------
+# 		NAMELIST OF THE KERNEL BENCHMARK smilei_kernel_bench
+#
+# A single patch of thermal plasma (electrons, ions) and photons.
+# The following variables can be defined on the command line, before this file:
+#   geometry      : "1Dcartesian", "2Dcartesian" or "3Dcartesian"
+#   order         : interpolation order (2 or 4)
+#   vectorization : mode of the Vectorization block ("off" or "on")
+#   ppc           : particles per cell
+#   cells         : cells of the patch in each direction
+#   mixed         : mixed_precision of the electrons (3Dcartesian, order 2, vectorized)
+#   ordering      : cell_ordering of the Vectorization block ("row_major", "morton" or "hilbert")
+# For instance:
+#   ./smilei_kernel_bench "geometry='2Dcartesian'; vectorization='on'" tools/kernel_bench/kernel_bench.py
+# ----------------------------------------------------------------------------------------
+
+import math as m
+
+geometry      = globals().get( "geometry", "3Dcartesian" )
+order         = globals().get( "order", 2 )
+vectorization = globals().get( "vectorization", "off" )
+ppc           = globals().get( "ppc", 32 )
+cells         = globals().get( "cells", 16 )
+mixed         = globals().get( "mixed", False )
+ordering      = globals().get( "ordering", "row_major" )
+
+ndim = int( geometry[0] )
+T    = 10./511.                 # temperature in me c^2
+dx   = 0.5*m.sqrt(T)            # half the Debye length
+dt   = 0.95 * dx/m.sqrt(ndim)   # 0.95 x CFL
+
+Main(
+    geometry = geometry,
+    interpolation_order = order,
+    timestep = dt,
+    simulation_time = dt,
+    cell_length  = [dx]*ndim,
+    grid_length = [cells*dx]*ndim,
+    number_of_patches = [1]*ndim,
+    EM_boundary_conditions = [ ["periodic"] ],
+    print_every = 1,
+)
+
+Vectorization(
+    mode = vectorization,
+    cell_ordering = ordering,
+)
+
+for name, mass, charge, pusher in [ ["electron", 1., -1., "boris"], ["ion", 1836., 1., "vay"] ]:
+    Species(
+        name = name,
+        position_initialization = "random",
+        momentum_initialization = "mj",
+        particles_per_cell = ppc,
+        mass = mass,
+        charge = charge,
+        number_density = 1.,
+        temperature = [T],
+        pusher = pusher,
+        mixed_precision = mixed and name == "electron",
+        boundary_conditions = [ ["periodic"] ],
+    )
+
+Species(
+    name = "photon",
+    position_initialization = "random",
+    momentum_initialization = "cold",
+    mean_velocity = [0.9, 0.1, 0.],
+    particles_per_cell = ppc//4,
+    mass = 0.,
+    charge = 0.,
+    number_density = 1.,
+    pusher = "norm",
+    boundary_conditions = [ ["periodic"] ],
+)
@@ -0,0 +1,297 @@
+// ---------------------------------------------------------------------------------------------------------------------
+//! Main.cpp for the tool smilei_simd_bench
+//! This tool compares the explicit-SIMD kernels (config=simd_kernels) to the `#pragma omp simd` loops
+//! of the vectorized 3D order-2 interpolator and projector (Interpolator3D2OrderV, Projector3D2OrderV),
+//! on a single core.
+//! The operators are the ones of Smilei, created by InterpolatorFactory and ProjectorFactory from a namelist,
+//! for the particles of a single patch and synthetic electromagnetic fields. Both kernels are timed on the
+//! same operator objects (switch simd_kernels_), and their results are compared.
+//! The SIMD instruction set is given by the compiler flags (for instance CXXFLAGS="-march=native").
+// ---------------------------------------------------------------------------------------------------------------------
+
+#if !defined( SMILEI_SIMD_KERNELS )
+#error "smilei_simd_bench requires config=simd_kernels"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <omp.h>
+
+#include "SmileiMPI.h"
+#include "Params.h"
+#include "OpenPMDparams.h"
+#include "VectorPatch.h"
+#include "PatchesFactory.h"
+#include "RadiationTables.h"
+#include "SimWindow.h"
+#include "ElectroMagn.h"
+#include "Field.h"
+#include "Species.h"
+#include "Particles.h"
+#include "InterpolatorFactory.h"
+#include "ProjectorFactory.h"
+#include "Interpolator3D2OrderV.h"
+#include "Projector3D2OrderV.h"
+#include "Simd.h"
+#include "Tools.h"
+
+using namespace std;
+namespace simd = smilei::tools::simd;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tools
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Smooth synthetic values for the fields seen by the particles
+void fillField( Field *field, double amplitude, double phase )
+{
+    if( !field ) {
+        return;
+    }
+    for( unsigned int i=0 ; i<field->number_of_points_ ; i++ ) {
+        field->data_[i] = amplitude * sin( 0.37*i + phase );
+    }
+}
+
+//! Copy of the values of a field, or of a buffer of interpolated fields
+template<typename T>
+vector<double> values( const T *data, unsigned int size )
+{
+    return vector<double>( data, data + size );
+}
+
+//! Maximum absolute difference between two sets of values
+double maxDifference( const vector<double> &a, const vector<double> &b )
+{
+    double max_diff = 0.;
+    for( unsigned int i=0 ; i<a.size() ; i++ ) {
+        max_diff = max( max_diff, fabs( a[i] - b[i] ) );
+    }
+    return max_diff;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Operators called as in SpeciesV::dynamics (a single pack of cells)
+// ---------------------------------------------------------------------------------------------------------------------
+
+void interpolate( Interpolator *Interp, Species *species, ElectroMagn *EMfields, SmileiMPI *smpi )
+{
+    Particles &particles = *species->particles;
+    for( unsigned int ibin = 0 ; ibin < particles.first_index.size() ; ibin++ ) {
+        Interp->fieldsWrapper( EMfields, particles, smpi, &( particles.first_index[ibin] ), &( particles.last_index[ibin] ),
+                               0, ibin, particles.first_index[0] );
+    }
+}
+
+void project( Projector *Proj, Species *species, ElectroMagn *EMfields, SmileiMPI *smpi, Params &params, unsigned int ispec )
+{
+    Particles &particles = *species->particles;
+    for( unsigned int ibin = 0 ; ibin < particles.first_index.size() ; ibin++ ) {
+        Proj->currentsAndDensityWrapper( EMfields, particles, smpi, particles.first_index[ibin], particles.last_index[ibin],
+                                         0, false, params.is_spectral, ispec, ibin, particles.first_index[0] );
+    }
+}
+
+//! Interpolated fields of all the particles, in the buffers of the thread 0
+vector<double> interpolatedFields( SmileiMPI &smpi, bool mixed_precision, unsigned int nparticles )
+{
+    vector<double> fields;
+    if( mixed_precision ) {
+        fields = values( smpi.dynamics_Epart_float[0].data(), 3*nparticles );
+        vector<double> B = values( smpi.dynamics_Bpart_float[0].data(), 3*nparticles );
+        fields.insert( fields.end(), B.begin(), B.end() );
+    } else {
+        fields = values( smpi.dynamics_Epart[0].data(), 3*nparticles );
+        vector<double> B = values( smpi.dynamics_Bpart[0].data(), 3*nparticles );
+        fields.insert( fields.end(), B.begin(), B.end() );
+    }
+    return fields;
+}
+
+//! Current densities of the patch
+vector<double> currents( ElectroMagn *EMfields )
+{
+    vector<double> J = values( EMfields->Jx_->data_, EMfields->Jx_->number_of_points_ );
+    vector<double> Jy = values( EMfields->Jy_->data_, EMfields->Jy_->number_of_points_ );
+    vector<double> Jz = values( EMfields->Jz_->data_, EMfields->Jz_->number_of_points_ );
+    J.insert( J.end(), Jy.begin(), Jy.end() );
+    J.insert( J.end(), Jz.begin(), Jz.end() );
+    return J;
+}
+
+void resetCurrents( ElectroMagn *EMfields )
+{
+    EMfields->Jx_->put_to( 0. );
+    EMfields->Jy_->put_to( 0. );
+    EMfields->Jz_->put_to( 0. );
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Report
+// ---------------------------------------------------------------------------------------------------------------------
+
+void printResult( const string &kernel, const string &version, double seconds, unsigned int repetitions, unsigned int nparticles, double max_diff )
+{
+    const double particles_per_second = seconds > 0. ? ( double )repetitions * nparticles / seconds : 0.;
+    cout << "   " << left << setw( 14 ) << kernel << setw( 10 ) << version << right
+         << scientific << setprecision( 3 )
+         << setw( 12 ) << ( particles_per_second > 0. ? 1e9 / particles_per_second : 0. ) << " ns/particle"
+         << setw( 12 ) << particles_per_second << " particles/s";
+    if( max_diff >= 0. ) {
+        cout << "   max difference: " << max_diff;
+    }
+    cout << endl;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------------------------------------------------
+
+int main( int argc, char *argv[] )
+{
+    string help_message;
+    help_message =  "\n This tool compares the explicit-SIMD kernels of Smilei to the vectorized (omp simd) kernels,\n";
+    help_message += " for the vectorized 3D order-2 interpolator and projector, on a single core.\n";
+    help_message += " Usage: smilei_simd_bench [-r repetitions] namelist(s)\n";
+    help_message += " The namelists are given as for smilei, for instance:\n";
+    help_message += "   smilei_simd_bench \"vectorization='on'\" tools/kernel_bench/kernel_bench.py\n";
+    help_message += " List of available commands:\n";
+    help_message += " -h              print a help message and exit.\n";
+    help_message += " -r repetitions  number of calls of each operator (default 20).\n";
+
+    // Command line: options of the tool, then the namelists
+    unsigned int repetitions = 20;
+    vector<string> namelists;
+    for( int i = 1 ; i < argc ; i++ ) {
+        const string argument( argv[i] );
+        if( argument == "-h" ) {
+            cout << help_message << endl;
+            return 0;
+        } else if( argument == "-r" && i+1 < argc ) {
+            repetitions = atoi( argv[++i] );
+        } else {
+            namelists.push_back( argument );
+        }
+    }
+    if( namelists.empty() ) {
+        cout << help_message << endl;
+        return 1;
+    }
+
+    // Single core
+#ifdef _OMP
+    omp_set_num_threads( 1 );
+#endif
+
+    // Same initialization as Smilei (singleton MPI, no launcher needed)
+    SmileiMPI smpi( &argc, &argv );
+    if( smpi.getSize() > 1 ) {
+        ERROR( "smilei_simd_bench runs on a single MPI process" );
+    }
+
+    TITLE( "Reading the simulation parameters" );
+    Params params( &smpi, namelists );
+    OpenPMDparams openPMD( params );
+    PyTools::setIteration( 0 );
+
+    if( params.geometry != "3Dcartesian" || params.interpolation_order != 2 ) {
+        ERROR( "smilei_simd_bench requires the 3Dcartesian geometry and interpolation_order = 2" );
+    }
+
+    VectorPatch vecPatches( params );
+    smpi.init( params, vecPatches.domain_decomposition_ );
+    SimWindow simWindow( params );
+    RadiationTables radiation_tables;
+
+    TITLE( "Creating the patch" );
+    PatchesFactory::createVector( vecPatches, params, &smpi, openPMD, &radiation_tables, 0 );
+    vecPatches.initialParticleSorting( params );
+    if( vecPatches.size() != 1 ) {
+        ERROR( "smilei_simd_bench requires a single patch (number_of_patches = [1, 1, 1])" );
+    }
+
+    Patch *patch = vecPatches( 0 );
+    ElectroMagn *EMfields = patch->EMfields;
+    fillField( EMfields->Ex_, 0.05, 0.0 );
+    fillField( EMfields->Ey_, 0.05, 1.0 );
+    fillField( EMfields->Ez_, 0.05, 2.0 );
+    fillField( EMfields->Bx_m, 0.05, 3.0 );
+    fillField( EMfields->By_m, 0.05, 4.0 );
+    fillField( EMfields->Bz_m, 0.05, 5.0 );
+
+    cout << "\n SIMD kernels benchmark: " << simd::Vector::name() << " (" << simd::Vector::width << " doubles per vector), "
+         << repetitions << " repetitions\n" << endl;
+
+    for( unsigned int ispec = 0 ; ispec < patch->vecSpecies.size() ; ispec++ ) {
+        Species *species = patch->vecSpecies[ispec];
+        Particles &particles = *species->particles;
+        const unsigned int nparticles = particles.numberOfParticles();
+        if( nparticles == 0 ) {
+            continue;
+        }
+
+        Interpolator *Interp = InterpolatorFactory::create( params, patch, species->vectorized_operators, species->mixed_precision_ );
+        Interpolator3D2OrderV *InterpV = dynamic_cast<Interpolator3D2OrderV *>( Interp );
+        if( !InterpV ) {
+            cout << " Species " << species->name_ << ": skipped (not vectorized)\n" << endl;
+            delete Interp;
+            continue;
+        }
+
+        cout << " Species " << species->name_ << ": " << nparticles << " particles"
+             << ( species->mixed_precision_ ? ", mixed precision" : "" ) << endl;
+
+        smpi.resizeBuffers( 0, params.nDim_field, nparticles, false, species->mixed_precision_ );
+
+        // Interpolator: omp simd loops, then explicit-SIMD kernels
+        double time[2];
+        vector<double> result[2];
+        for( unsigned int ikernel = 0 ; ikernel < 2 ; ikernel++ ) {
+            InterpV->simd_kernels_ = ( ikernel == 1 );
+            interpolate( Interp, species, EMfields, &smpi );
+            result[ikernel] = interpolatedFields( smpi, species->mixed_precision_, nparticles );
+            time[ikernel] = 0.;
+            for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+                const double t0 = MPI_Wtime();
+                interpolate( Interp, species, EMfields, &smpi );
+                time[ikernel] += MPI_Wtime() - t0;
+            }
+        }
+        printResult( "Interpolator", "omp simd", time[0], repetitions, nparticles, -1. );
+        printResult( "Interpolator", simd::Vector::name(), time[1], repetitions, nparticles, maxDifference( result[0], result[1] ) );
+
+        // Projector: particles pushed once by the pusher of the species, then projected from the same state
+        if( species->mass_ > 0 && !particles.is_test ) {
+            Projector *Proj = ProjectorFactory::create( params, patch, species->vectorized_operators );
+            Projector3D2OrderV *ProjV = dynamic_cast<Projector3D2OrderV *>( Proj );
+            ( *species->Push )( particles, &smpi, 0, particles.last_index.back(), 0, particles.first_index[0] );
+            for( unsigned int ikernel = 0 ; ikernel < 2 ; ikernel++ ) {
+                ProjV->simd_kernels_ = ( ikernel == 1 );
+                resetCurrents( EMfields );
+                project( Proj, species, EMfields, &smpi, params, ispec );
+                result[ikernel] = currents( EMfields );
+                time[ikernel] = 0.;
+                for( unsigned int irep = 0 ; irep < repetitions ; irep++ ) {
+                    const double t0 = MPI_Wtime();
+                    project( Proj, species, EMfields, &smpi, params, ispec );
+                    time[ikernel] += MPI_Wtime() - t0;
+                }
+            }
+            printResult( "Projector", "omp simd", time[0], repetitions, nparticles, -1. );
+            printResult( "Projector", simd::Vector::name(), time[1], repetitions, nparticles, maxDifference( result[0], result[1] ) );
+            delete Proj;
+        }
+
+        delete Interp;
+        cout << endl;
+    }
+
+    vecPatches.close( &smpi );
+    smpi.barrier();
+    return 0;
+}
@@ -0,0 +1,22 @@
+import os, re, numpy as np, math, h5py
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Same as tst3d_00_em_propagation with the tiled Maxwell solver and temporal blocking
+
+# COMPARE THE FIELDS
+for field in ["Ex","Ey","Ez","Bx","By","Bz"]:
+	F = S.Field.Field0(field, average={"z":S.namelist.Main.grid_length[2]*0.3}, timesteps=240).getData()[0]
+	Validate(field+" field at iteration 240", F, 0.01)
+
+# 0-D PROBE IN 3D
+Ey = S.Probe.Probe0.Ey().getData()
+Validate("0-D probe Ey vs time", Ey, 0.01)
+# 2-D PROBE IN 3D
+Ey = S.Probe.Probe1.Ey(timesteps=240).getData()[0]
+Validate("2-D probe Ey at last iteration", Ey, 0.01)
+
+# TEST THAT Ubal_norm STAYS OK
+max_ubal_norm = np.max( np.abs(S.Scalar.Ubal_norm().getData()) )
+Validate("Max Ubal_norm is below 10%", max_ubal_norm<.1 )
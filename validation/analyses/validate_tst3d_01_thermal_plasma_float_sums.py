@@ -0,0 +1,23 @@
+import os, re, numpy as np, math
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+# Same as tst3d_01_thermal_plasma with the densities summed in single precision between MPI processes
+
+# COMPARE THE FIELDS
+for field in ["Ex","By","Jz","Rho_electron"]:
+	F = S.Field.Field0(field, average={"z":S.namelist.Main.grid_length[2]*0.5}, timesteps=160).getData()[0]
+	Validate(field+" field at iteration 160", F, 0.01)
+
+# SCALARS
+Validate("Scalar Ukin", S.Scalar.Ukin().getData(), 0.01)
+Validate("Scalar Uelm", S.Scalar.Uelm().getData(), 0.001)
+
+# TEST THAT Ubal_norm STAYS OK
+max_ubal_norm = np.max( np.abs(S.Scalar.Ubal_norm().getData()) )
+Validate("Max Ubal_norm is below 10%", max_ubal_norm<.1 )
+
+# ROUNDING ERROR OF THE SUMS SENT IN SINGLE PRECISION
+sums_error = np.max( S.Performances(raw="sums_relative_error").getData() )
+Validate("Relative error of the sums below the tolerance", sums_error <= S.namelist.Main.float_sums_tolerance )
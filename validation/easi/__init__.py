@@ -339,7 +339,7 @@ class Validation(object):
         global _dataNotMatching
         _dataNotMatching = False
         for BENCH in self.list_benchmarks():
-            SMILEI_BENCH = self.smilei_path.benchmarks + BENCH
+            SMILEI_NAMELISTS = self.list_namelists(BENCH)
             
             # Prepare specific resources if requested in a resource file
             if BENCH in self.resources:
@@ -363,7 +363,7 @@ class Validation(object):
             RESTART_INFO = ""
             if options.nb_restarts > 0:
                 # Load the namelist
-                namelist = happi.openNamelist(SMILEI_BENCH)
+                namelist = happi.openNamelist(SMILEI_NAMELISTS)
                 niter = namelist.Main.simulation_time / namelist.Main.timestep
                 # If the simulation does not have enough timesteps, change the number of restarts
                 if options.nb_restarts > niter - 4:
@@ -434,7 +434,7 @@ class Validation(object):
                 #         sys.exit(2)
                 
                 # If there are restarts, adds the Checkpoints block
-                arguments = SMILEI_BENCH
+                arguments = " ".join(SMILEI_NAMELISTS)
                 if options.nb_restarts > 0:
                     if irestart == 0:
                         RESTART_DIR = "None"
@@ -555,6 +555,18 @@ class Validation(object):
             print("")
         
         return benchmarks
+    
+    def list_namelists(self, BENCH):
+        # A benchmark may extend other input files, each named in a line "# extends <file>"
+        # (relative to the benchmarks folder): Smilei reads them before the benchmark
+        import re
+        namelists = []
+        with open(self.smilei_path.benchmarks + BENCH) as f:
+            for line in f:
+                extends = re.match(r"#\s*extends\s+(\S+)", line)
+                if extends:
+                    namelists.append(self.smilei_path.benchmarks + extends.group(1))
+        return namelists + [self.smilei_path.benchmarks + BENCH]
 
     #Compare the results of given "simulation_dir" to the reference results of the given benchname.
     def compare(self, benchname, simulation_dir):
@@ -594,10 +606,17 @@ class Validation(object):
         def __call__(self, data_name, data, precision=None, error_type="absolute_error"):
             self.data[data_name] = data
 
+        # The bench is validated against the reference of another bench: nothing to create
+        def useReference(self, bench_name):
+            print("Uses the reference of "+bench_name+": no reference created")
+            self.reference_file = None
+
         def write(self):
             import pickle
             from os.path import getsize
             from os import remove
+            if self.reference_file is None:
+                return
             with open(self.reference_file, "wb") as f:
                 pickle.dump(self.data, f)
             size = getsize(self.reference_file)
@@ -609,11 +628,20 @@ class Validation(object):
     # DEFINE A CLASS TO COMPARE A SIMULATION TO A REFERENCE
     class CompareToReference(object):
         def __init__(self, references_path, bench_name):
-            self.ref_data = loadReference(references_path, bench_name)
+            self.references_path = references_path
+            self.bench_name = bench_name
+            self.ref_data = None
+
+        # Validate against the reference of another bench (same diagnostics expected)
+        def useReference(self, bench_name):
+            self.bench_name = bench_name
+            self.ref_data = None
         
         def __call__(self, data_name, data, precision=None, error_type="absolute_error"):
             global _dataNotMatching
             from sys import exit
+            if self.ref_data is None:
+                self.ref_data = loadReference(self.references_path, self.bench_name)
             # verify the name is in the reference
             if data_name not in self.ref_data.keys():
                 print(" Reference quantity '"+data_name+"' not found")
@@ -631,7 +659,14 @@ class Validation(object):
     # DEFINE A CLASS TO VIEW DIFFERENCES BETWEEN A SIMULATION AND A REFERENCE
     class ShowDiffWithReference(object):
         def __init__(self, references_path, bench_name):
-            self.ref_data = loadReference(references_path, bench_name)
+            self.references_path = references_path
+            self.bench_name = bench_name
+            self.ref_data = None
+
+        # Validate against the reference of another bench (same diagnostics expected)
+        def useReference(self, bench_name):
+            self.bench_name = bench_name
+            self.ref_data = None
         
         def __call__(self, data_name, data, precision=None, error_type="absolute_error"):
             global _dataNotMatching
@@ -640,6 +675,8 @@ class Validation(object):
             plt.ion()
             print(" Showing differences about '"+data_name+"'")
             display.seperator()
+            if self.ref_data is None:
+                self.ref_data = loadReference(self.references_path, self.bench_name)
             # verify the name is in the reference
             if data_name not in self.ref_data.keys():
                 print("\tReference quantity not found")